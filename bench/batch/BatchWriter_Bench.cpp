@@ -0,0 +1,66 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "opengemini/impl/batch/BatchWriter.hpp"
+#include "opengemini/impl/comm/Context.hpp"
+
+namespace opengemini::bench {
+
+namespace {
+
+std::shared_ptr<impl::batch::BatchWriter> ConstructWriter(impl::Context& ctx)
+{
+    // Completes the batches at once, so that only appending is measured.
+    return impl::batch::BatchWriter::Construct(
+        ctx(),
+        BatchConfig{ std::chrono::milliseconds(100), 5000 },
+        [](impl::batch::BatchWriter::Target,
+           std::vector<Point>,
+           impl::batch::BatchWriter::Handler handler) { handler(nullptr); });
+}
+
+} // namespace
+
+static void AppendPointsConcurrently(benchmark::State& state)
+{
+    static impl::Context                             ctx(1);
+    static std::shared_ptr<impl::batch::BatchWriter> writer;
+    if (state.thread_index() == 0) { writer = ConstructWriter(ctx); }
+
+    const Point point{ "cpu_usage",
+                       { { "usage_user", 12.5 }, { "processes", 31 } },
+                       {},
+                       { { "host", "server-" +
+                                       std::to_string(state.thread_index()) },
+                         { "region", "cn-north-1" } } };
+    auto target = std::make_shared<const impl::cli::WriteTarget>("db", "rp");
+    for (auto _ : state) {
+        writer->Append(target, point, [](std::exception_ptr) { });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        writer->Stop();
+        writer.reset();
+    }
+}
+BENCHMARK(AppendPointsConcurrently)->ThreadRange(1, 64)->UseRealTime();
+
+} // namespace opengemini::bench
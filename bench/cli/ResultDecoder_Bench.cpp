@@ -0,0 +1,109 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include "opengemini/impl/cli/query/ResultDecoder.hpp"
+
+namespace opengemini::bench {
+
+namespace {
+
+// A response of one series holding about size bytes of rows.
+std::string GenerateQueryResponse(std::size_t size)
+{
+    std::string body{ R"({"results":[{"statement_id":0,"series":[{)"
+                      R"("name":"cpu_usage","tags":{"region":"cn-north-1"},)"
+                      R"("columns":["time","usage_user","processes",)"
+                      R"("host","healthy"],"values":[)" };
+    body.reserve(size + 256);
+    for (std::size_t idx = 0; body.size() < size; ++idx) {
+        if (idx != 0) { body.push_back(','); }
+        body.append("[")
+            .append(std::to_string(1700000000000000000 + idx))
+            .append(",")
+            .append(std::to_string(12.5 + static_cast<double>(idx % 100) / 7))
+            .append(",")
+            .append(std::to_string(idx * 31))
+            .append(",\"server-")
+            .append(std::to_string(idx % 64))
+            .append("\",")
+            .append(idx % 2 == 0 ? "true" : "false")
+            .append("]");
+    }
+    body.append("]}]}]}");
+    return body;
+}
+
+} // namespace
+
+static void DecodeQueryResultFromDocument(benchmark::State& state)
+{
+    const auto body =
+        GenerateQueryResponse(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = nlohmann::json::parse(body).get<QueryResult>();
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * body.size());
+}
+BENCHMARK(DecodeQueryResultFromDocument)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Arg(1 << 30)
+    ->Unit(benchmark::kMillisecond);
+
+static void DecodeQueryResultInOnePass(benchmark::State& state)
+{
+    const auto body =
+        GenerateQueryResponse(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = impl::cli::DecodeQueryResult(body);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * body.size());
+}
+BENCHMARK(DecodeQueryResultInOnePass)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Arg(1 << 30)
+    ->Unit(benchmark::kMillisecond);
+
+static void DecodeColumnarResult(benchmark::State& state)
+{
+    const auto body =
+        GenerateQueryResponse(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = impl::cli::DecodeColumnarResult(body);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * body.size());
+}
+BENCHMARK(DecodeColumnarResult)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Arg(1 << 30)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace opengemini::bench
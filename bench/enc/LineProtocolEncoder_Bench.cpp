@@ -0,0 +1,307 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "opengemini/impl/comm/Context.hpp"
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+#include "opengemini/impl/enc/ParallelEncoder.hpp"
+#include "opengemini/impl/enc/SeriesCache.hpp"
+
+namespace opengemini::bench {
+
+struct CpuUsage {
+    std::string host;
+    std::string rack;
+    std::string region;
+    bool        healthy;
+    int64_t     processes;
+    std::string state;
+    uint64_t    uptime;
+    double      usageSystem;
+    double      usageUser;
+    Point::Time time;
+};
+
+} // namespace opengemini::bench
+
+namespace opengemini {
+
+template<>
+struct Schema<bench::CpuUsage> {
+    using Record = bench::CpuUsage;
+
+    static constexpr auto measurement = schema::Measurement("cpu_usage");
+    static constexpr auto tags =
+        std::make_tuple(schema::Tag("host", &Record::host),
+                        schema::Tag("rack", &Record::rack),
+                        schema::Tag("region", &Record::region));
+    static constexpr auto fields =
+        std::make_tuple(schema::Field("healthy", &Record::healthy),
+                        schema::Field("processes", &Record::processes),
+                        schema::Field("state", &Record::state),
+                        schema::Field("uptime", &Record::uptime),
+                        schema::Field("usage_system", &Record::usageSystem),
+                        schema::Field("usage_user", &Record::usageUser));
+    static constexpr auto time = &Record::time;
+};
+
+} // namespace opengemini
+
+namespace opengemini::bench {
+
+namespace {
+
+std::vector<Point> GeneratePoints(std::size_t count)
+{
+    std::vector<Point> points;
+    points.reserve(count);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        auto seq = static_cast<int64_t>(idx);
+        points.push_back(
+            { "cpu_usage",
+              { { "usage_user", 12.5 + static_cast<double>(idx % 100) / 7 },
+                { "usage_system", static_cast<double>(idx % 37) },
+                { "processes", seq * 31 },
+                { "uptime", static_cast<uint64_t>(idx) * 1000003 },
+                { "healthy", idx % 2 == 0 },
+                { "state", "running" } },
+              Point::Time{ std::chrono::seconds(1700000000 + seq) },
+              { { "host", "server-" + std::to_string(idx % 64) },
+                { "region", "cn-north-1" },
+                { "rack", std::to_string(idx % 8) } } });
+    }
+    return points;
+}
+
+// The points of GeneratePoints() as records described by Schema.
+std::vector<CpuUsage> GenerateRecords(std::size_t count)
+{
+    std::vector<CpuUsage> records;
+    records.reserve(count);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        auto seq = static_cast<int64_t>(idx);
+        records.push_back(
+            { "server-" + std::to_string(idx % 64),
+              std::to_string(idx % 8),
+              "cn-north-1",
+              idx % 2 == 0,
+              seq * 31,
+              "running",
+              static_cast<uint64_t>(idx) * 1000003,
+              static_cast<double>(idx % 37),
+              12.5 + static_cast<double>(idx % 100) / 7,
+              Point::Time{ std::chrono::seconds(1700000000 + seq) } });
+    }
+    return records;
+}
+
+// The points of GeneratePoints() which belong to one series, in columns.
+PointBatch GeneratePointBatch(std::size_t count)
+{
+    std::vector<double>      user;
+    std::vector<double>      system;
+    std::vector<int64_t>     processes;
+    std::vector<uint64_t>    uptime;
+    std::vector<bool>        healthy;
+    std::vector<std::string> state;
+    std::vector<Point::Time> times;
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        auto seq = static_cast<int64_t>(idx);
+        user.push_back(12.5 + static_cast<double>(idx % 100) / 7);
+        system.push_back(static_cast<double>(idx % 37));
+        processes.push_back(seq * 31);
+        uptime.push_back(static_cast<uint64_t>(idx) * 1000003);
+        healthy.push_back(idx % 2 == 0);
+        state.push_back("running");
+        times.emplace_back(std::chrono::seconds(1700000000 + seq));
+    }
+    return { "cpu_usage",
+             { { "usage_user", std::move(user) },
+               { "usage_system", std::move(system) },
+               { "processes", std::move(processes) },
+               { "uptime", std::move(uptime) },
+               { "healthy", std::move(healthy) },
+               { "state", std::move(state) } },
+             std::move(times),
+             { { "host", "server-0" },
+               { "region", "cn-north-1" },
+               { "rack", "0" } } };
+}
+
+std::vector<Point> GenerateFloatPoints(bool sensorLike)
+{
+    constexpr std::size_t points{ 1000 };
+    constexpr std::size_t fields{ 100 };
+
+    std::mt19937_64                        engine(42);
+    std::uniform_real_distribution<double> random(-1e6, 1e6);
+    std::normal_distribution<double>       sensor(21.5, 3.0);
+
+    std::vector<Point> result(points, Point{ "sensor" });
+    for (auto& point : result) {
+        for (std::size_t idx = 0; idx < fields; ++idx) {
+            // Sensors report values with a fixed number of decimal places.
+            auto value = sensorLike ? std::round(sensor(engine) * 10) / 10
+                                    : random(engine);
+            point.fields.emplace("f" + std::to_string(idx), value);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+static void EncodeFloatFields(benchmark::State& state)
+{
+    const auto points = GenerateFloatPoints(state.range(0) != 0);
+
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        auto content = impl::enc::LineProtocolEncoder{}.Encode(points);
+        bytes += content.size();
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * points.size() *
+                            points.front().fields.size());
+}
+BENCHMARK(EncodeFloatFields)->ArgName("sensor")->Arg(0)->Arg(1);
+
+static void EncodePoints(benchmark::State& state)
+{
+    const auto points =
+        GeneratePoints(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        auto content = impl::enc::LineProtocolEncoder{}.Encode(points);
+        bytes += content.size();
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(EncodePoints)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void EncodePointsReusingBuffer(benchmark::State& state)
+{
+    const auto points =
+        GeneratePoints(static_cast<std::size_t>(state.range(0)));
+
+    std::string content;
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        content =
+            impl::enc::LineProtocolEncoder{ std::move(content) }.Encode(points);
+        bytes += content.size();
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(EncodePointsReusingBuffer)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void EncodePointsWithSeriesCache(benchmark::State& state)
+{
+    const auto points =
+        GeneratePoints(static_cast<std::size_t>(state.range(0)));
+
+    impl::enc::SeriesCache cache(1024);
+    std::size_t            bytes{ 0 };
+    for (auto _ : state) {
+        auto content = impl::enc::LineProtocolEncoder{ &cache }.Encode(points);
+        bytes += content.size();
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(EncodePointsWithSeriesCache)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void EncodeRecords(benchmark::State& state)
+{
+    const auto records =
+        GenerateRecords(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        auto content = impl::enc::LineProtocolEncoder{}.Encode(records);
+        bytes += content.size();
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(EncodeRecords)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void EncodePointBatch(benchmark::State& state)
+{
+    const auto batch =
+        GeneratePointBatch(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        auto content = impl::enc::LineProtocolEncoder{}.Encode(batch);
+        bytes += content.size();
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(EncodePointBatch)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void EncodePointsInParallel(benchmark::State& state)
+{
+    const auto points =
+        GeneratePoints(static_cast<std::size_t>(state.range(0)));
+    const auto threads = static_cast<std::size_t>(state.range(1));
+
+    impl::Context              ctx(threads);
+    impl::enc::ParallelEncoder encoder(ctx(), 1, ctx.Concurrency());
+
+    std::size_t bytes{ 0 };
+    for (auto _ : state) {
+        bytes += boost::asio::spawn(
+                     ctx(),
+                     [&](auto yield) {
+                         return encoder
+                             .Encode(
+                                 points, Precision::Nanosecond, nullptr, yield)
+                             .Size();
+                     },
+                     boost::asio::use_future)
+                     .get();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(EncodePointsInParallel)
+    ->ArgNames({ "points", "threads" })
+    ->ArgsProduct({ { 100000, 500000 }, { 1, 2, 4, 8 } })
+    ->UseRealTime();
+
+} // namespace opengemini::bench
@@ -0,0 +1,35 @@
+# Copyright 2024 openGemini Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+include_guard()
+include(FetchContent)
+
+message(STATUS "Looking for zlib.")
+find_package(ZLIB ${OPENGEMINI_FIND_PACKAGE_REQUIRED})
+
+if(NOT ZLIB_FOUND AND OPENGEMINI_USE_FETCHCONTENT)
+    message(STATUS "zlib not found, try using FetchContent instead.")
+    FetchContent_Declare(zlib
+        GIT_REPOSITORY https://github.com/madler/zlib
+        GIT_TAG        v1.3.1
+        GIT_PROGRESS   TRUE
+    )
+    FetchContent_MakeAvailable(zlib)
+    target_include_directories(zlibstatic
+        INTERFACE
+            $<BUILD_INTERFACE:${zlib_SOURCE_DIR}>
+            $<BUILD_INTERFACE:${zlib_BINARY_DIR}>
+    )
+    add_library(ZLIB::ZLIB ALIAS zlibstatic)
+endif()
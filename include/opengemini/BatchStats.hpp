@@ -0,0 +1,85 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/// @file BatchStats.hpp
+#ifndef OPENGEMINI_BATCHSTATS_HPP
+#define OPENGEMINI_BATCHSTATS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief The current batching policy and the counters of the batches sent.
+/// @see ClientConfig::batchConfig
+///
+/// \~Chinese
+/// @brief 当前批量策略及已发送批量的计数。
+/// @see ClientConfig::batchConfig
+///
+struct BatchStats {
+    ///
+    /// \~English
+    /// @brief Number of points that triggers a batching request currently.
+    ///
+    /// \~Chinese
+    /// @brief 当前触发批量请求的点位数量。
+    ///
+    std::size_t batchSize{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Time interval that triggers a batching request currently.
+    ///
+    /// \~Chinese
+    /// @brief 当前触发批量请求的时间间隔。
+    ///
+    std::chrono::milliseconds batchInterval{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Smoothed latency of writing a batch, measured from sending the
+    /// batch till it is acknowledged or failed.
+    ///
+    /// \~Chinese
+    /// @brief 批量写入的平滑延迟，从发送批量起至其被确认或失败为止。
+    ///
+    std::chrono::milliseconds latency{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Number of batches sent so far.
+    ///
+    /// \~Chinese
+    /// @brief 迄今已发送的批量数量。
+    ///
+    std::uint64_t flushes{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Number of batches failed so far.
+    ///
+    /// \~Chinese
+    /// @brief 迄今写入失败的批量数量。
+    ///
+    std::uint64_t failures{ 0 };
+};
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_BATCHSTATS_HPP
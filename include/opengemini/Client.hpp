@@ -17,11 +17,19 @@
 
 #include <memory>
 
+#include "opengemini/BatchStats.hpp"
 #include "opengemini/ClientConfig.hpp"
+#include "opengemini/ColumnarResult.hpp"
 #include "opengemini/CompletionToken.hpp"
 #include "opengemini/Point.hpp"
+#include "opengemini/PointBatch.hpp"
+#include "opengemini/PointSpan.hpp"
 #include "opengemini/Query.hpp"
 #include "opengemini/RetentionPolicy.hpp"
+#include "opengemini/Schema.hpp"
+#include "opengemini/SeriesCacheStats.hpp"
+#include "opengemini/WriteQueueStats.hpp"
+#include "opengemini/Writer.hpp"
 
 namespace opengemini {
 
@@ -139,6 +147,104 @@ public:
     template<typename COMPLETION_TOKEN = token::Sync>
     [[nodiscard]] auto Query(struct Query query, COMPLETION_TOKEN&& token = {});
 
+    ///
+    /// \~English
+    /// @brief Query data from database, and return the results in columns.
+    /// @details Same as the other overload, except that the results are
+    /// returned as @ref ColumnarQueryResult, in which every column of a series
+    /// is stored in a contiguous vector of its own type.
+    /// @param query The query statement as @ref struct Query.
+    /// @param format Pass @ref format::columnar.
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error,
+    ///     // On success, the query result.
+    ///     ColumnarQueryResult result
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 从数据库查询数据，并按列返回查询结果。
+    /// @details 与另一重载相同，但查询结果以 @ref ColumnarQueryResult 返回，
+    /// 其中时序数据的每一列都存放在各自类型的连续数组中。
+    /// @param query 查询语句 @ref struct Query 。
+    /// @param format 传递 @ref format::columnar 。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error,
+    ///     // 当操作成功时，承载查询结果。
+    ///     ColumnarQueryResult result
+    /// )
+    /// @endcode
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Query(struct Query       query,
+                             format::Columnar   format,
+                             COMPLETION_TOKEN&& token = {});
+
+    ///
+    /// \~English
+    /// @brief Query data from database in chunks.
+    /// @details Asks the server to return the results in chunks of at most
+    /// chunkSize rows, each chunk is decoded as soon as it arrives and its
+    /// series are handed to handler one by one, so that no more than one chunk
+    /// is held in memory. The response is not read any further while handler
+    /// is running, a slow handler therefore slows down the server instead of
+    /// piling up the results.
+    /// @param query The query statement as @ref struct Query.
+    /// @param chunkSize Maximum number of rows in each chunk, the server
+    /// decides it if the value is 0.
+    /// @param handler The function which receives the series, it is invoked
+    /// on the threads of the client and must not block for long.
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 以分块方式从数据库查询数据。
+    /// @details
+    /// 要求服务端分块返回查询结果，每块最多包含chunkSize行。
+    /// 每个分块到达后立即解码，其中的时序数据将逐个交给handler，
+    /// 因此内存中至多只保留一个分块。handler执行期间不会继续读取响应，
+    /// 处理较慢时将减缓服务端的发送，而不是堆积结果。
+    /// @param query 查询语句 @ref struct Query 。
+    /// @param chunkSize 每个分块的最大行数，值为0时由服务端决定。
+    /// @param handler 接收时序数据的函数，将在客户端的线程中被调用，
+    /// 不应长时间阻塞。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto QueryChunked(struct Query       query,
+                                    std::size_t        chunkSize,
+                                    SeriesHandler      handler,
+                                    COMPLETION_TOKEN&& token = {});
+
     ///
     /// \~English
     /// @brief Creates a new database.
@@ -438,6 +544,400 @@ public:
                              std::string_view   retentionPolicy = {},
                              COMPLETION_TOKEN&& token           = {});
 
+    ///
+    /// \~English
+    /// @brief Write multiple points held by the caller without copying them.
+    /// @details The points are borrowed until the write completes, they are
+    /// sent in their own request even if @ref ClientConfig::batchConfig is
+    /// specified.
+    /// @param database Name of the database.
+    /// @param points A view of the points, see @ref PointSpan .
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. Only @ref token::sync and @ref token::coro are accepted,
+    /// because the points must not be released before the write completes.
+    ///
+    /// \~Chinese
+    /// @brief 写入调用者持有的多个点位，不对点位进行拷贝。
+    /// @details 点位在写入完成前被借用，即使指定了 @ref
+    /// ClientConfig::batchConfig ，这些点位也将通过单独的请求发送。
+    /// @param database 数据库名称。
+    /// @param points 点位的视图，参考 @ref PointSpan 。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 仅接受 @ref token::sync 和 @ref token::coro ，因为点位在写入完成前
+    /// 不能被释放。
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Write(std::string_view   database,
+                             PointSpan          points,
+                             std::string_view   retentionPolicy = {},
+                             COMPLETION_TOKEN&& token           = {});
+
+    ///
+    /// \~English
+    /// @brief Write contiguous points held by the caller without copying
+    /// them.
+    /// @details Same as the overload taking a @ref PointSpan .
+    /// @param database Name of the database.
+    /// @param points Pointer to the first point.
+    /// @param count Number of the points.
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. Only @ref token::sync and @ref token::coro are accepted.
+    ///
+    /// \~Chinese
+    /// @brief 写入调用者持有的连续点位，不对点位进行拷贝。
+    /// @details 与接受 @ref PointSpan 的重载相同。
+    /// @param database 数据库名称。
+    /// @param points 指向首个点位的指针。
+    /// @param count 点位数量。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 仅接受 @ref token::sync 和 @ref token::coro 。
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Write(std::string_view   database,
+                             const Point*       points,
+                             std::size_t        count,
+                             std::string_view   retentionPolicy = {},
+                             COMPLETION_TOKEN&& token           = {});
+
+    ///
+    /// \~English
+    /// @brief Write the points of one series held in columns.
+    /// @details Lines are encoded straight from the columns. The batch is
+    /// sent in its own request, even if @ref ClientConfig::batchConfig is
+    /// specified.
+    /// @param database Name of the database.
+    /// @param batch The points in columns, see @ref PointBatch .
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 写入按列存放的同一序列的多个点位。
+    /// @details 直接从各列编码出行协议。即使指定了 @ref
+    /// ClientConfig::batchConfig ，该批点位也将通过单独的请求发送。
+    /// @param database 数据库名称。
+    /// @param batch 按列存放的点位，参考 @ref PointBatch 。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Write(std::string_view   database,
+                             PointBatch         batch,
+                             std::string_view   retentionPolicy = {},
+                             COMPLETION_TOKEN&& token           = {});
+
+    ///
+    /// \~English
+    /// @brief Write multiple records of a user defined type as points.
+    /// @details The type must be described by a specialization of @ref
+    /// Schema . The records are sent in their own request, even if @ref
+    /// ClientConfig::batchConfig is specified.
+    /// @param database Name of the database.
+    /// @param records The records to be written.
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 将用户自定义类型的多个记录作为点位写入。
+    /// @details 该类型必须由 @ref Schema 的特化进行描述。即使指定了 @ref
+    /// ClientConfig::batchConfig ，这些记录也将通过单独的请求发送。
+    /// @param database 数据库名称。
+    /// @param records 待写入的记录。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    template<typename RECORD,
+             typename COMPLETION_TOKEN = token::Sync,
+             typename                  = std::enable_if_t<HasSchema_v<RECORD>>>
+    [[nodiscard]] auto Write(std::string_view    database,
+                             std::vector<RECORD> records,
+                             std::string_view    retentionPolicy = {},
+                             COMPLETION_TOKEN&&  token           = {});
+
+    ///
+    /// \~English
+    /// @brief Write line protocol produced by the caller as is.
+    /// @details The body is sent without being parsed or copied, in its own
+    /// request even if @ref ClientConfig::batchConfig is specified. Unless
+    /// validate is false, it is scanned for lines starting with a comma or
+    /// having no field set, which fail the write with @ref
+    /// errc::LogicErrors::InvalidArgument .
+    /// @param database Name of the database.
+    /// @param body Lines of line protocol separated by LF.
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param validate Whether to scan the lines before sending them, default
+    /// to true.
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 按原样写入调用者生成的行协议。
+    /// @details 请求体不经解析或拷贝直接发送，即使指定了 @ref
+    /// ClientConfig::batchConfig 也将通过单独的请求发送。除非 validate
+    /// 为false，否则将检查以逗号开头或缺少字段集的行，存在此类行时写入以 @ref
+    /// errc::LogicErrors::InvalidArgument 错误结束。
+    /// @param database 数据库名称。
+    /// @param body 以LF分隔的行协议。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param validate 发送前是否检查各行，默认值为true。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto WriteRaw(std::string_view   database,
+                                std::string        body,
+                                std::string_view   retentionPolicy = {},
+                                bool               validate        = true,
+                                COMPLETION_TOKEN&& token           = {});
+
+    ///
+    /// \~English
+    /// @brief Write line protocol held by the caller as is.
+    /// @details Same as the overload taking a std::string, except that the
+    /// body is borrowed from memory kept alive by owner until the write
+    /// completes.
+    /// @param database Name of the database.
+    /// @param body Lines of line protocol separated by LF.
+    /// @param owner Keeps the memory of body alive, may be null if the caller
+    /// guarantees it otherwise.
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param validate Whether to scan the lines before sending them, default
+    /// to true.
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 按原样写入调用者持有的行协议。
+    /// @details 与接受std::string的重载相同，区别在于请求体借用自 owner
+    /// 所维持的内存，直到写入完成。
+    /// @param database 数据库名称。
+    /// @param body 以LF分隔的行协议。
+    /// @param owner 维持 body 所在内存的有效性，若调用者以其他方式保证则可为空。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param validate 发送前是否检查各行，默认值为true。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto WriteRaw(std::string_view            database,
+                                std::string_view            body,
+                                std::shared_ptr<const void> owner,
+                                std::string_view retentionPolicy = {},
+                                bool             validate        = true,
+                                COMPLETION_TOKEN&& token         = {});
+
+    ///
+    /// \~English
+    /// @brief Write line protocol held by the caller in multiple buffers as
+    /// is.
+    /// @details Same as the overload taking a std::string_view, the buffers
+    /// are sent one after another and a line may span buffers.
+    /// @param database Name of the database.
+    /// @param buffers Pieces of lines of line protocol separated by LF.
+    /// @param owner Keeps the memory of buffers alive, may be null if the
+    /// caller guarantees it otherwise.
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @param validate Whether to scan the lines before sending them, default
+    /// to true.
+    /// @param token The completion token which will be invoked when the task
+    /// complete. Default to @ref token::sync if this parameter is not
+    /// specified. If passing function object as token, the function signature
+    /// must be:
+    /// @code
+    /// void (
+    ///     // Result of operation, it means success if the value is nullptr,
+    ///     // otherwise, contains an exception.
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    /// \~Chinese
+    /// @brief 按原样写入调用者以多个缓冲区持有的行协议。
+    /// @details 与接受std::string_view的重载相同，各缓冲区依次发送，
+    /// 单行可以跨越多个缓冲区。
+    /// @param database 数据库名称。
+    /// @param buffers 以LF分隔的行协议片段。
+    /// @param owner 维持 buffers 所在内存的有效性，若调用者以其他方式保证则可为空。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @param validate 发送前是否检查各行，默认值为true。
+    /// @param token 任务完成令牌，将在任务完成后被调用。
+    /// 若没有指定该参数，则使用默认值：@ref token::sync 。
+    /// 若传递函数对象作为完成令牌，则其签名必须满足：
+    /// @code
+    /// void (
+    ///     // 执行结果，仅当值为nullptr时代表成功，否则将承载相关的异常。
+    ///     std::exception_ptr error
+    /// )
+    /// @endcode
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto WriteRaw(std::string_view              database,
+                                std::vector<std::string_view> buffers,
+                                std::shared_ptr<const void>   owner,
+                                std::string_view retentionPolicy = {},
+                                bool             validate        = true,
+                                COMPLETION_TOKEN&& token         = {});
+
+    ///
+    /// \~English
+    /// @brief Bind a writer to a retention policy of a database.
+    /// @details The returned @ref Writer reuses the request target built here
+    /// for all of its writes, which is cheaper than calling @ref Write with
+    /// the names again and again.
+    /// @param database Name of the database.
+    /// @param retentionPolicy Name of the retention policy, default to empty
+    /// string (no retention policy is specified).
+    /// @return The writer, which must not be used after the client is
+    /// destroyed.
+    /// @throw Exception with @ref errc::LogicErrors::InvalidArgument if the
+    /// database name is empty.
+    ///
+    /// \~Chinese
+    /// @brief 绑定一个写入器到数据库的保留策略。
+    /// @details 返回的 @ref Writer
+    /// 的所有写入都将复用此处构建的请求目标，开销低于反复携带名称调用 @ref
+    /// Write 。
+    /// @param database 数据库名称。
+    /// @param retentionPolicy
+    /// 保留策略名称，默认值为空字符串（即不指定保留策略）。
+    /// @return 写入器，在客户端销毁后不能再被使用。
+    /// @throw 若数据库名称为空，则抛出携带 @ref
+    /// errc::LogicErrors::InvalidArgument 的异常。
+    ///
+    Writer BindWriter(std::string_view database,
+                      std::string_view retentionPolicy = {});
+
+    ///
+    /// \~English
+    /// @brief Get the counters of the series cache.
+    /// @return All zero if the cache is not enabled.
+    /// @see ClientConfig::seriesCacheCapacity
+    ///
+    /// \~Chinese
+    /// @brief 获取序列缓存计数。
+    /// @return 若未开启缓存，则所有计数均为0。
+    /// @see ClientConfig::seriesCacheCapacity
+    ///
+    struct SeriesCacheStats SeriesCacheStats() const;
+
+    ///
+    /// \~English
+    /// @brief Get the counters of the writes held by the client.
+    /// @return All zero if no limit is configured.
+    /// @see ClientConfig::backpressureConfig
+    ///
+    /// \~Chinese
+    /// @brief 获取客户端所持有写入的计数。
+    /// @return 若未配置限制，则所有计数均为0。
+    /// @see ClientConfig::backpressureConfig
+    ///
+    struct WriteQueueStats WriteQueueStats() const;
+
+    ///
+    /// \~English
+    /// @brief Get the current batching policy and the counters of the batches
+    /// sent, which reflect the adaptation if
+    /// @ref BatchConfig::adaptive is specified.
+    /// @return All zero if batching is not enabled.
+    /// @see ClientConfig::batchConfig
+    ///
+    /// \~Chinese
+    /// @brief 获取当前批量策略及已发送批量的计数，若指定
+    /// @ref BatchConfig::adaptive ，则反映自适应调整的结果。
+    /// @return 若未开启批量，则所有计数均为0。
+    /// @see ClientConfig::batchConfig
+    ///
+    struct BatchStats BatchStats() const;
+
 private:
     Client(const Client&)            = delete;
     Client& operator=(const Client&) = delete;
@@ -61,6 +61,52 @@ using AuthToken = std::string;
 ///
 using AuthConfig = std::variant<AuthCredential, AuthToken>;
 
+///
+/// \~English
+/// @brief Hold the configs that let the batching policy adapt to the
+/// observed latency of writes.
+/// @details The batch size grows additively while the batches filled up are
+/// written within the target latency, and is halved once a write fails or
+/// exceeds the target latency. The batch interval shrinks in proportion while
+/// the batch size is below @ref BatchConfig::batchSize, which is also the
+/// initial batch size.
+///
+/// \~Chinese
+/// @brief 自适应批量配置，使批量策略根据观测到的写入延迟进行调整。
+/// @details 当写满的批量在目标延迟内写入成功时，批量大小按加法递增；
+/// 一旦写入失败或超出目标延迟，批量大小减半。当批量大小小于
+/// @ref BatchConfig::batchSize 时，批量间隔按比例缩短，该值同时也是初始批量大小。
+///
+struct AdaptiveBatchConfig {
+    ///
+    /// \~English
+    /// @brief Lower bound of the batch size, must be greater than zero.
+    ///
+    /// \~Chinese
+    /// @brief 批量大小的下限，必须大于0。
+    ///
+    std::size_t minBatchSize;
+
+    ///
+    /// \~English
+    /// @brief Upper bound of the batch size, must not be less than
+    /// @ref minBatchSize.
+    ///
+    /// \~Chinese
+    /// @brief 批量大小的上限，不得小于 @ref minBatchSize 。
+    ///
+    std::size_t maxBatchSize;
+
+    ///
+    /// \~English
+    /// @brief The latency within which a batch is expected to be written.
+    ///
+    /// \~Chinese
+    /// @brief 期望批量写入完成的延迟。
+    ///
+    std::chrono::milliseconds targetLatency;
+};
+
 ///
 /// \~English
 /// @brief Hold the configs that control the batching policy.
@@ -99,6 +145,416 @@ struct BatchConfig {
     /// @details 如果累计的点位数量超出最大值，则立即发送一次聚合请求。
     ///
     std::size_t batchSize;
+
+    ///
+    /// \~English
+    /// @brief Whether to coalesce the points of a batch before sending it,
+    /// default to false.
+    /// @details The points are grouped by series, and the points of a series
+    /// with the same time and precision are merged into one line holding the
+    /// union of their fields, the field written later wins.
+    ///
+    /// \~Chinese
+    /// @brief 发送前是否合并批量中的点位，默认值为false。
+    /// @details 点位按序列分组，同一序列中时间及精度相同的点位被合并为一行，
+    /// 其字段为这些点位字段的并集，同名字段以后写入的为准。
+    ///
+    bool coalescePoints{ false };
+
+    ///
+    /// \~English
+    /// @brief Whether to sort the points of every series by time when
+    /// coalescing a batch, default to false.
+    /// @details Takes effect only if @ref coalescePoints is enabled.
+    ///
+    /// \~Chinese
+    /// @brief 合并批量时是否将每个序列的点位按时间排序，默认值为false。
+    /// @details 仅在启用 @ref coalescePoints 时生效。
+    ///
+    bool sortByTime{ false };
+
+    ///
+    /// \~English
+    /// @brief Adapt the batch size and interval to the observed latency of
+    /// writes if specified, default to std::nullopt.
+    ///
+    /// \~Chinese
+    /// @brief 若指定该配置，则根据观测到的写入延迟调整批量大小及间隔，
+    /// 默认值为std::nullopt。
+    ///
+    std::optional<AdaptiveBatchConfig> adaptive{ std::nullopt };
+
+    ///
+    /// \~English
+    /// @brief How long the destruction of the client waits for the pending
+    /// batches to be written, default to 5 seconds.
+    /// @details The writes which have not completed by then fail with
+    /// @ref errc::RuntimeErrors::WriteDropped .
+    ///
+    /// \~Chinese
+    /// @brief 销毁客户端时等待未完成批量写入的时长，默认值为5秒。
+    /// @details 届时仍未完成的写入将以 @ref errc::RuntimeErrors::WriteDropped
+    /// 错误结束。
+    ///
+    std::chrono::milliseconds stopTimeout{ std::chrono::seconds(5) };
+};
+
+///
+/// \~English
+/// @brief The gzip configuration for client.
+///
+/// \~Chinese
+/// @brief 客户端gzip配置。
+///
+struct GzipConfig {
+    ///
+    /// \~English
+    /// @brief Compression level in range [0, 9], default to 6.
+    /// @details 0 means no compression, 1 gives best speed and 9 gives best
+    /// compression.
+    ///
+    /// \~Chinese
+    /// @brief 压缩等级，取值范围[0, 9]，默认值为6。
+    /// @details 0表示不压缩，1表示速度最快，9表示压缩率最高。
+    ///
+    int level{ 6 };
+
+    ///
+    /// \~English
+    /// @brief Minimum size in bytes of a request body to be compressed,
+    /// default to 1024.
+    /// @details Request bodies smaller than this size will be sent without
+    /// compression.
+    ///
+    /// \~Chinese
+    /// @brief 请求体被压缩的最小字节数，默认值为1024。
+    /// @details 小于该值的请求体将不经压缩直接发送。
+    ///
+    std::size_t minBodySize{ 1024 };
+};
+
+///
+/// \~English
+/// @brief What to do with a write which would exceed the limits of @ref
+/// BackpressureConfig .
+///
+/// \~Chinese
+/// @brief 写入将超出 @ref BackpressureConfig 的限制时的处理方式。
+///
+enum class OverflowPolicy {
+    ///
+    /// \~English
+    /// @brief Blocks the calling thread until the write fits.
+    /// @details A write issued from a thread of the client, e.g. in a
+    /// completion handler, is accepted without blocking, because blocking
+    /// those threads would stop the writes in flight from completing.
+    ///
+    /// \~Chinese
+    /// @brief 阻塞调用线程，直到可以容纳该写入。
+    /// @details 在客户端自身线程（例如完成回调）中发起的写入将不经阻塞直接被接受，
+    /// 因为阻塞这些线程将导致正在进行的写入无法完成。
+    ///
+    Block,
+
+    ///
+    /// \~English
+    /// @brief Fails the write with @ref errc::RuntimeErrors::WriteQueueFull .
+    ///
+    /// \~Chinese
+    /// @brief 以 @ref errc::RuntimeErrors::WriteQueueFull 错误结束该写入。
+    ///
+    Fail,
+
+    ///
+    /// \~English
+    /// @brief Drops the oldest queued writes until the write fits, the dropped
+    /// ones fail with @ref errc::RuntimeErrors::WriteDropped . If it still
+    /// does not fit, the write fails as @ref Fail .
+    ///
+    /// \~Chinese
+    /// @brief 丢弃最早排队的写入直到可以容纳该写入，被丢弃的写入以 @ref
+    /// errc::RuntimeErrors::WriteDropped 错误结束。
+    /// 若仍无法容纳，则该写入按 @ref Fail 处理。
+    ///
+    DropOldest,
+};
+
+///
+/// \~English
+/// @brief How the client chooses the server of a write.
+///
+/// \~Chinese
+/// @brief 客户端为写入选择服务端的方式。
+///
+enum class WriteRouting {
+    ///
+    /// \~English
+    /// @brief Sends every write to the next available server in turn.
+    ///
+    /// \~Chinese
+    /// @brief 依次将每次写入发送到下一个可用的服务端。
+    ///
+    RoundRobin,
+
+    ///
+    /// \~English
+    /// @brief Sends the points of a series (measurement and tags) to the same
+    /// server, chosen by consistent hashing among the available ones.
+    /// @details A write of points from several series is split into one
+    /// request per server, which are sent concurrently. If a server becomes
+    /// unavailable, only the series mapped to it move to other servers.
+    /// Records described by @ref Schema and raw line protocol are sent as
+    /// with @ref RoundRobin .
+    ///
+    /// \~Chinese
+    /// @brief 将同一序列（度量及标签）的点位发送到同一服务端，
+    /// 该服务端通过一致性哈希从可用服务端中选出。
+    /// @details 包含多个序列点位的写入将按服务端拆分为多个请求并发发送。
+    /// 若某个服务端不可用，仅映射到该服务端的序列会转移到其他服务端。
+    /// 由 @ref Schema 描述的记录及原始行协议按 @ref RoundRobin 方式发送。
+    ///
+    BySeries,
+};
+
+///
+/// \~English
+/// @brief Limits the writes held by a client, so that its memory stays
+/// bounded when the server slows down.
+/// @details A write is held from being issued until it completes, either
+/// being sent or waiting in queue to be sent. A limit of 0 means unlimited.
+/// The size of a write is estimated from the points it carries.
+///
+/// \~Chinese
+/// @brief 限制客户端持有的写入，使服务端变慢时客户端内存保持有界。
+/// @details 写入从发起直到完成期间均被客户端持有，
+/// 此期间写入或正在发送，或在队列中等待发送。限制值为0表示不限制。
+/// 写入的大小根据其携带的点位估算。
+///
+struct BackpressureConfig {
+    ///
+    /// \~English
+    /// @brief Max number of write requests being sent at the same time, the
+    /// other writes wait in queue.
+    ///
+    /// \~Chinese
+    /// @brief 同时发送的最大写请求数量，其余写入在队列中等待。
+    ///
+    std::size_t maxInflightRequests{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Max number of writes waiting in queue.
+    ///
+    /// \~Chinese
+    /// @brief 队列中等待的最大写入数量。
+    ///
+    std::size_t maxQueuedRequests{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Max total size in bytes of the writes held. A single write
+    /// larger than it is accepted only if no other write is held.
+    ///
+    /// \~Chinese
+    /// @brief 所持有写入的最大总字节数。
+    /// 超过该值的单个写入仅在没有持有其他写入时才会被接受。
+    ///
+    std::size_t maxInflightBytes{ 0 };
+
+    ///
+    /// \~English
+    /// @brief What to do with a write which would exceed the limits, default
+    /// to @ref OverflowPolicy::Block .
+    ///
+    /// \~Chinese
+    /// @brief 写入将超出限制时的处理方式，默认值为 @ref OverflowPolicy::Block 。
+    ///
+    OverflowPolicy overflowPolicy{ OverflowPolicy::Block };
+};
+
+///
+/// \~English
+/// @brief Keeps writes on disk while no server is available, and replays them
+/// once a server passes the health check again.
+/// @details The encoded writes are appended to segment files in the
+/// directory, the progress of replaying is saved in a checkpoint file, so the
+/// writes not replayed yet survive a restart of the process. The writes
+/// appended within the last @ref syncInterval may be lost if the machine
+/// crashes. Segments written by versions without a format version are
+/// rejected with @ref errc::RuntimeErrors::SpillFailed on construction.
+///
+/// \~Chinese
+/// @brief 在没有可用服务端时将写入保存到磁盘，并在服务端重新通过健康检查后重放。
+/// @details 编码后的写入被追加到目录下的分段文件中，重放进度保存在检查点文件中，
+/// 因此尚未重放的写入在进程重启后依然保留。机器崩溃时，最近 @ref syncInterval
+/// 内追加的写入可能丢失。构造时遇到由无格式版本的旧版本写入的分段文件将以 @ref
+/// errc::RuntimeErrors::SpillFailed 错误结束。
+///
+struct SpillConfig {
+    ///
+    /// \~English
+    /// @brief The directory to keep the writes, which should be used by one
+    /// client only. It is created if not exists.
+    ///
+    /// \~Chinese
+    /// @brief 保存写入的目录，仅应由一个客户端使用。目录不存在时将被创建。
+    ///
+    std::string directory;
+
+    ///
+    /// \~English
+    /// @brief Max bytes of the files in the directory, default to 1GiB. Writes
+    /// beyond it fail with @ref errc::RuntimeErrors::SpillFailed .
+    ///
+    /// \~Chinese
+    /// @brief 目录中文件的最大字节数，默认值为1GiB。超出后的写入以 @ref
+    /// errc::RuntimeErrors::SpillFailed 错误结束。
+    ///
+    std::size_t maxDiskBytes{ 1024 * 1024 * 1024 };
+
+    ///
+    /// \~English
+    /// @brief Bytes of a segment file before starting a new one, default to
+    /// 64MiB. A segment is removed once all of its writes are replayed.
+    ///
+    /// \~Chinese
+    /// @brief 开始新分段文件前单个分段文件的字节数，默认值为64MiB。
+    /// 分段中的写入全部重放后该文件将被删除。
+    ///
+    std::size_t segmentBytes{ 64 * 1024 * 1024 };
+
+    ///
+    /// \~English
+    /// @brief Max bytes replayed per second, default to 0 (unlimited).
+    ///
+    /// \~Chinese
+    /// @brief 每秒重放的最大字节数，默认值为0（不限制）。
+    ///
+    std::size_t replayBytesPerSecond{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Max time the appended writes stay unsynced to the storage device,
+    /// default to 1 second, 0 syncs every write.
+    /// @details The writes are synced when the next write is appended, or
+    /// when the replay wakes up every second once appending stops.
+    ///
+    /// \~Chinese
+    /// @brief 追加的写入未同步到存储设备的最长时间，默认值为1秒，0表示同步每次写入。
+    /// @details 写入在追加下一个写入时同步，或在停止追加后由每秒唤醒一次的重放同步。
+    ///
+    std::chrono::milliseconds syncInterval{ 1000 };
+};
+
+///
+/// \~English
+/// @brief How many endpoint groups must accept a replicated write before it
+/// completes, see @ref ReplicationConfig .
+///
+/// \~Chinese
+/// @brief 复制写入完成前需要接受该写入的端点组数量，参考 @ref
+/// ReplicationConfig 。
+///
+enum class AckPolicy {
+    ///
+    /// \~English
+    /// @brief Every group.
+    ///
+    /// \~Chinese
+    /// @brief 所有端点组。
+    ///
+    All,
+
+    ///
+    /// \~English
+    /// @brief More than half of the groups.
+    ///
+    /// \~Chinese
+    /// @brief 超过半数的端点组。
+    ///
+    Quorum,
+
+    ///
+    /// \~English
+    /// @brief Any one of the groups.
+    ///
+    /// \~Chinese
+    /// @brief 任意一个端点组。
+    ///
+    Any,
+};
+
+///
+/// \~English
+/// @brief Replicates every write to groups of endpoints, e.g. independent
+/// clusters, besides @ref ClientConfig::addresses .
+/// @details A write is encoded once and sent to every group concurrently, each
+/// group has its own health check, and its own spill directory if @ref
+/// ClientConfig::spillConfig is specified, the subdirectory "replica-N" of the
+/// directory for the N-th (starting from 1) group. A write completes as soon
+/// as enough groups have accepted it, while the requests to the other groups
+/// keep going on. A write of points from several series is not split when
+/// routing by series, each group picks its server by the first series of the
+/// write.
+///
+/// \~Chinese
+/// @brief 除 @ref ClientConfig::addresses
+/// 外，将每次写入复制到其他端点组，例如相互独立的集群。
+/// @details 写入仅被编码一次，并发发送到每个端点组。每个端点组独立进行健康检查，
+/// 若指定了 @ref ClientConfig::spillConfig
+/// ，每个端点组也使用独立的保存目录，即第N（从1开始）个端点组使用该目录下的子目录
+/// "replica-N"。足够多的端点组接受写入后该写入即完成，发往其他端点组的请求继续进行。
+/// 按序列路由时，包含多个序列点位的写入不会被拆分，
+/// 每个端点组根据写入中的第一个序列选择服务端。
+///
+struct ReplicationConfig {
+    ///
+    /// \~English
+    /// @brief The groups of endpoints to replicate writes to.
+    ///
+    /// \~Chinese
+    /// @brief 写入复制的目标端点组。
+    ///
+    std::vector<std::vector<Endpoint>> replicas;
+
+    ///
+    /// \~English
+    /// @brief How many groups, including the one of @ref
+    /// ClientConfig::addresses , must accept a write before it completes,
+    /// default to @ref AckPolicy::All .
+    ///
+    /// \~Chinese
+    /// @brief 写入完成前需要接受该写入的端点组数量（包括 @ref
+    /// ClientConfig::addresses 所在的端点组），默认值为 @ref AckPolicy::All 。
+    ///
+    AckPolicy ackPolicy{ AckPolicy::All };
+
+    ///
+    /// \~English
+    /// @brief Number of times a group resends a write it failed to accept,
+    /// default to 2.
+    /// @details A write rejected by the server with a 4xx status is not resent.
+    /// Once the retries run out, the write is spilled to the directory of the
+    /// group if @ref ClientConfig::spillConfig is specified, whether or not
+    /// the write has completed already.
+    ///
+    /// \~Chinese
+    /// @brief 端点组未能接受写入时重新发送的次数，默认值为2。
+    /// @details 被服务端以4xx状态码拒绝的写入不会重新发送。重试次数用尽后，
+    /// 若指定了 @ref ClientConfig::spillConfig
+    /// ，无论该写入是否已经完成，都将被保存到该端点组的目录中。
+    ///
+    std::size_t retries{ 2 };
+
+    ///
+    /// \~English
+    /// @brief Time to wait before the first resend of a write, doubled for
+    /// every following one, default to 100 milliseconds.
+    ///
+    /// \~Chinese
+    /// @brief 首次重新发送写入前的等待时间，此后每次加倍，默认值为100毫秒。
+    ///
+    std::chrono::milliseconds retryInterval{ 100 };
 };
 
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
@@ -209,10 +665,17 @@ struct ClientConfig {
     /// @brief Batching configuration, default to @code std::nullopt
     /// @endcode (All of @ref WritePoint requests will be sent immediately
     /// instead of being aggregated).
+    /// @details If specified, points written to the same database and
+    /// retention policy are accumulated and sent in one request, and the
+    /// completion token of each write is invoked after the request which
+    /// carries its points completes.
     ///
     /// \~Chinese
     /// @brief 批量配置，默认值为 @code std::nullopt @endcode
     /// （所有的@ref WritePoint 请求立即被发送，不会被聚合）。
+    /// @details
+    /// 若指定该配置，写入同一数据库及保留策略的点位将被聚合后通过一次请求发送，
+    /// 每次写入的完成令牌将在承载其点位的请求完成后被调用。
     ///
     std::optional<BatchConfig> batchConfig{ std::nullopt };
 
@@ -237,12 +700,28 @@ struct ClientConfig {
     ///
     /// \~English
     /// @brief Whether to enable gzip, default to false.
+    /// @details If enabled, request bodies will be compressed with gzip and
+    /// the server will be asked to compress its responses.
     ///
     /// \~Chinese
     /// @brief 是否开启gzip，默认值为false。
+    /// @details 若开启，请求体将使用gzip压缩，并要求服务端压缩其响应。
     ///
     bool gzipEnabled{ false };
 
+    ///
+    /// \~English
+    /// @brief The gzip configuration, default to @code std::nullopt @endcode
+    /// (Client will use the default value of @ref GzipConfig ). Only has
+    /// effect if @ref gzipEnabled is true.
+    ///
+    /// \~Chinese
+    /// @brief gzip配置，默认值为@code std::nullopt @endcode
+    /// (客户端内部将使用 @ref GzipConfig 默认值)。仅当 @ref gzipEnabled
+    /// 为true时生效。
+    ///
+    std::optional<GzipConfig> gzipConfig{ std::nullopt };
+
     ///
     /// \~English
     /// @brief A hint about the level of concurrency.
@@ -255,6 +734,94 @@ struct ClientConfig {
     /// 客户端可能参考该值选择合适的线程数。默认值为0（由客户端自行决定）。
     ///
     std::size_t concurrencyHint{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Minimum number of points in one write to be encoded in parallel,
+    /// default to 0 (never encode in parallel).
+    /// @details Such writes are split into slices which are encoded on all of
+    /// the client's threads before the request is sent, with the order of
+    /// points preserved. The whole encoded body is then held in memory,
+    /// whereas smaller writes are encoded while being sent.
+    ///
+    /// \~Chinese
+    /// @brief 单次写入中触发并行编码的最小点位数量，默认值为0（不进行并行编码）。
+    /// @details 达到该数量的写入将被切分后在客户端所有线程上并行编码，
+    /// 点位顺序保持不变，编码完成后再发送请求，因此整个请求体将驻留内存；
+    /// 较小的写入则在发送过程中边编码边发送。
+    ///
+    std::size_t parallelEncodeThreshold{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Max number of series whose encoded measurement and tags are
+    /// cached, default to 0 (no cache).
+    /// @details Useful if points are written repeatedly for a fixed set of
+    /// series, the series not used recently are evicted once the cache is
+    /// full. See @ref Client::SeriesCacheStats for the hit rate.
+    ///
+    /// \~Chinese
+    /// @brief 缓存已编码的度量及标签的最大序列数量，默认值为0（不缓存）。
+    /// @details 适用于持续向固定序列集合写入点位的场景，
+    /// 缓存满后将淘汰近期未使用的序列。命中率可参考 @ref
+    /// Client::SeriesCacheStats 。
+    ///
+    std::size_t seriesCacheCapacity{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Limits of the writes held by the client, default to @code
+    /// std::nullopt @endcode (unlimited).
+    /// @details Applies to the requests of aggregated writes as well if @ref
+    /// batchConfig is specified. See @ref Client::WriteQueueStats for the
+    /// current usage.
+    ///
+    /// \~Chinese
+    /// @brief 客户端所持有写入的限制，默认值为 @code std::nullopt
+    /// @endcode（不限制）。
+    /// @details 若指定了 @ref batchConfig ，该限制同样作用于聚合写入的请求。
+    /// 当前用量可参考 @ref Client::WriteQueueStats 。
+    ///
+    std::optional<BackpressureConfig> backpressureConfig{ std::nullopt };
+
+    ///
+    /// \~English
+    /// @brief Spills writes to disk when no server is available, default to
+    /// @code std::nullopt @endcode (such writes fail with @ref
+    /// errc::ServerErrors::NoAvailableServer ).
+    /// @details A spilled write completes successfully. Aggregated writes are
+    /// spilled as well if @ref batchConfig is specified.
+    ///
+    /// \~Chinese
+    /// @brief 没有可用服务端时将写入保存到磁盘，默认值为 @code std::nullopt
+    /// @endcode（此类写入以 @ref errc::ServerErrors::NoAvailableServer
+    /// 错误结束）。
+    /// @details 被保存到磁盘的写入将成功完成。若指定了 @ref batchConfig
+    /// ，聚合写入同样会被保存。
+    ///
+    std::optional<SpillConfig> spillConfig{ std::nullopt };
+
+    ///
+    /// \~English
+    /// @brief How to choose the server of a write, default to @ref
+    /// WriteRouting::RoundRobin .
+    ///
+    /// \~Chinese
+    /// @brief 为写入选择服务端的方式，默认值为 @ref WriteRouting::RoundRobin
+    /// 。
+    ///
+    WriteRouting writeRouting{ WriteRouting::RoundRobin };
+
+    ///
+    /// \~English
+    /// @brief Replication of writes to other groups of endpoints, default to
+    /// @code std::nullopt @endcode (writes are sent to @ref addresses only).
+    ///
+    /// \~Chinese
+    /// @brief 将写入复制到其他端点组，默认值为 @code std::nullopt
+    /// @endcode（写入仅发送到 @ref addresses ）。
+    ///
+    std::optional<ReplicationConfig> replicationConfig{ std::nullopt };
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
 
     ///
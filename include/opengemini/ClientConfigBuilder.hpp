@@ -125,6 +125,20 @@ public:
     ///
     Self& BatchConfig(std::chrono::milliseconds interval, std::size_t size);
 
+    ///
+    /// \~English
+    /// @brief Set the strategy for write-point batching, including the
+    /// coalescing of batched points.
+    /// @see BatchConfig
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置点位写入功能的批量策略，包括批量点位的合并。
+    /// @see BatchConfig
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& BatchConfig(const struct BatchConfig& config);
+
     ///
     /// \~English
     /// @brief Set the read/write timeout.
@@ -164,6 +178,20 @@ public:
     ///
     Self& EnableGzip(bool enabled);
 
+    ///
+    /// \~English
+    /// @brief Set the gzip compression level and the minimum size of request
+    /// body to be compressed.
+    /// @see GzipConfig
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置gzip压缩等级及请求体被压缩的最小字节数。
+    /// @see GzipConfig
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& GzipConfig(int level, std::size_t minBodySize);
+
     ///
     /// \~English
     /// @brief Set the hint about the level of concurrency.
@@ -178,6 +206,94 @@ public:
     ///
     Self& ConcurrencyHint(std::size_t hint);
 
+    ///
+    /// \~English
+    /// @brief Set the minimum number of points in one write to be encoded in
+    /// parallel.
+    /// @param threshold 0 means never encode in parallel.
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置单次写入中触发并行编码的最小点位数量。
+    /// @param threshold 点位数量阈值，0表示不进行并行编码。
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& ParallelEncodeThreshold(std::size_t threshold);
+
+    ///
+    /// \~English
+    /// @brief Set the max number of series whose encoded measurement and tags
+    /// are cached.
+    /// @param capacity 0 means no cache.
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置缓存已编码的度量及标签的最大序列数量。
+    /// @param capacity 最大序列数量，0表示不缓存。
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& SeriesCacheCapacity(std::size_t capacity);
+
+    ///
+    /// \~English
+    /// @brief Set the limits of the writes held by the client.
+    /// @see BackpressureConfig
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置客户端所持有写入的限制。
+    /// @see BackpressureConfig
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& BackpressureConfig(std::size_t    maxInflightRequests,
+                             std::size_t    maxQueuedRequests,
+                             std::size_t    maxInflightBytes,
+                             OverflowPolicy policy = OverflowPolicy::Block);
+
+    ///
+    /// \~English
+    /// @brief Set the directory to spill writes to while no server is
+    /// available.
+    /// @see SpillConfig
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置没有可用服务端时保存写入的目录。
+    /// @see SpillConfig
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& SpillConfig(std::string directory,
+                      std::size_t maxDiskBytes,
+                      std::size_t segmentBytes,
+                      std::size_t replayBytesPerSecond = 0);
+
+    ///
+    /// \~English
+    /// @brief Set how to choose the server of a write.
+    /// @see WriteRouting
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置为写入选择服务端的方式。
+    /// @see WriteRouting
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& WriteRouting(WriteRouting routing);
+
+    ///
+    /// \~English
+    /// @brief Set the groups of endpoints to replicate writes to.
+    /// @see ReplicationConfig
+    /// @return Reference to the builder itself.
+    ///
+    /// \~Chinese
+    /// @brief 设置写入复制的目标端点组。
+    /// @see ReplicationConfig
+    /// @return 指向配置构造器自身的引用。
+    ///
+    Self& ReplicationConfig(std::vector<std::vector<Endpoint>> replicas,
+                            AckPolicy policy = AckPolicy::All);
+
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
     ///
     /// \~English
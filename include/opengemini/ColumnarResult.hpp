@@ -0,0 +1,106 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_COLUMNARRESULT_HPP
+#define OPENGEMINI_COLUMNARRESULT_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief Holds the string values of a column, every distinct value is stored
+/// only once in dictionary and each row refers to it by index.
+///
+/// \~Chinese
+/// @brief 存放字符串列的值，每个不同的值仅在dictionary中存放一次，
+/// 每一行通过下标引用。
+///
+struct StringColumn {
+    std::vector<std::string> dictionary;
+    std::vector<uint32_t>    codes;
+};
+
+///
+/// \~English
+/// @brief Holds the series data in typed columns.
+/// @details If the first column is "time" and holds integers only, it is
+/// moved to times. Every column has one value per row, the type of a column
+/// is decided by its non-null values: integers mixed with floats are stored
+/// as double, a column without any non-null value holds std::monostate. The
+/// nulls of a column is empty if no row is null, otherwise nulls[i] tells
+/// whether row i is null, in which case the value of row i is unspecified.
+///
+/// \~Chinese
+/// @brief 按类型化的列存放时序数据。
+/// @details 若第一列为"time"且仅包含整数，则该列被移至times。
+/// 每一列的每行都有一个值，列的类型由其非空值决定：
+/// 整数与浮点数混合时按double存放，不含任何非空值的列存放std::monostate。
+/// 若列中没有空值则nulls为空，否则nulls[i]表示第i行是否为空，
+/// 此时第i行的值未指定。
+///
+struct ColumnarSeries {
+    using Values = std::variant<std::monostate,
+                                std::vector<double>,
+                                std::vector<int64_t>,
+                                std::vector<uint64_t>,
+                                StringColumn,
+                                std::vector<bool>>;
+
+    struct Column {
+        std::string       name;
+        Values            values;
+        std::vector<bool> nulls;
+    };
+
+    std::string                                  name;
+    std::unordered_map<std::string, std::string> tags;
+    std::size_t                                  rows{ 0 };
+    std::vector<int64_t>                         times;
+    std::vector<Column>                          columns;
+};
+
+struct ColumnarSeriesResult {
+    std::vector<ColumnarSeries> series;
+    std::string                 error;
+};
+
+struct ColumnarQueryResult {
+    std::vector<ColumnarSeriesResult> results;
+    std::string                       error;
+};
+
+} // namespace opengemini
+
+namespace opengemini::format {
+
+class Columnar { };
+
+///
+/// \~English
+/// @brief Asks a query to return the results as @ref ColumnarQueryResult.
+///
+/// \~Chinese
+/// @brief 要求查询以 @ref ColumnarQueryResult 的形式返回结果。
+///
+constexpr Columnar columnar{};
+
+} // namespace opengemini::format
+
+#endif // !OPENGEMINI_COLUMNARRESULT_HPP
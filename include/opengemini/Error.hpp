@@ -138,6 +138,9 @@ enum class ServerErrors {
 
 enum class RuntimeErrors {
     Unexpected = 1,
+    WriteQueueFull,
+    WriteDropped,
+    SpillFailed,
 };
 
 } // namespace opengemini::errc
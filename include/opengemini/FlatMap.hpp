@@ -0,0 +1,291 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_FLATMAP_HPP
+#define OPENGEMINI_FLATMAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief An ordered associative container which keeps its elements sorted by
+/// key in one contiguous array.
+/// @details Provides the commonly used interfaces of std::map. Compared to
+/// std::map, it makes one allocation for all the elements instead of one per
+/// element, and iterates without chasing pointers. Insertion and erasure
+/// invalidate the iterators and references, and cost linear time, which is
+/// cheap for the small number of elements of a point. As std::map, the
+/// iterators refer to std::pair<const KEY, VALUE>, so keys cannot be modified
+/// in place.
+///
+/// \~Chinese
+/// @brief 有序关联容器，所有元素按键排序后存放于一段连续数组中。
+/// @details 提供std::map的常用接口。与std::map相比，
+/// 所有元素仅需一次内存分配，遍历时无需追踪指针。
+/// 插入及删除操作将使迭代器和引用失效，且耗时与元素数量成线性关系，
+/// 对于点位中数量较少的元素而言开销很小。与std::map相同，迭代器指向
+/// std::pair<const KEY, VALUE>，因此无法原地修改键。
+///
+template<typename KEY, typename VALUE>
+class FlatMap {
+public:
+    using key_type               = KEY;
+    using mapped_type            = VALUE;
+    using value_type             = std::pair<const KEY, VALUE>;
+    using size_type              = std::size_t;
+    using container_type         = std::vector<value_type>;
+    using iterator               = typename container_type::iterator;
+    using const_iterator         = typename container_type::const_iterator;
+    using reverse_iterator       = typename container_type::reverse_iterator;
+    using const_reverse_iterator =
+        typename container_type::const_reverse_iterator;
+
+public:
+    FlatMap() = default;
+
+    FlatMap(std::initializer_list<value_type> init) :
+        FlatMap(init.begin(), init.end())
+    { }
+
+    template<typename INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR first, INPUT_ITERATOR last)
+    {
+        // Sorted with mutable keys, which are then moved into the elements.
+        // Insertion sort is stable and does not allocate, which suits the few
+        // elements of a point. Keeps the first one of elements with
+        // equivalent keys, as std::map.
+        std::vector<std::pair<KEY, VALUE>> sorted(first, last);
+        auto less = [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        };
+        for (auto iter = sorted.begin(); iter != sorted.end(); ++iter) {
+            std::rotate(std::upper_bound(sorted.begin(), iter, *iter, less),
+                        iter,
+                        std::next(iter));
+        }
+        sorted.erase(std::unique(sorted.begin(),
+                                 sorted.end(),
+                                 [&less](const auto& lhs, const auto& rhs) {
+                                     return !less(lhs, rhs) && !less(rhs, lhs);
+                                 }),
+                     sorted.end());
+
+        elements_.reserve(sorted.size());
+        for (auto& element : sorted) {
+            elements_.emplace_back(std::move(element.first),
+                                   std::move(element.second));
+        }
+    }
+
+    FlatMap(const FlatMap&)                = default;
+    FlatMap(FlatMap&&) noexcept            = default;
+    FlatMap& operator=(FlatMap&&) noexcept = default;
+
+    // The elements cannot be assigned because of their const keys, so the
+    // copy replaces them as a whole.
+    FlatMap& operator=(const FlatMap& other)
+    {
+        if (this != &other) { container_type(other.elements_).swap(elements_); }
+        return *this;
+    }
+
+    iterator       begin() noexcept { return elements_.begin(); }
+    const_iterator begin() const noexcept { return elements_.begin(); }
+    const_iterator cbegin() const noexcept { return elements_.cbegin(); }
+    iterator       end() noexcept { return elements_.end(); }
+    const_iterator end() const noexcept { return elements_.end(); }
+    const_iterator cend() const noexcept { return elements_.cend(); }
+
+    reverse_iterator       rbegin() noexcept { return elements_.rbegin(); }
+    const_reverse_iterator rbegin() const noexcept { return elements_.rbegin(); }
+    reverse_iterator       rend() noexcept { return elements_.rend(); }
+    const_reverse_iterator rend() const noexcept { return elements_.rend(); }
+
+    bool      empty() const noexcept { return elements_.empty(); }
+    size_type size() const noexcept { return elements_.size(); }
+
+    void reserve(size_type capacity) { elements_.reserve(capacity); }
+    void clear() noexcept { elements_.clear(); }
+
+    template<typename K, typename... ARGS>
+    std::pair<iterator, bool> try_emplace(K&& key, ARGS&&... args)
+    {
+        auto iter = LowerBound(key);
+        if (iter != elements_.end() && !(key < iter->first)) {
+            return { iter, false };
+        }
+        if (iter == elements_.end()) {
+            elements_.emplace_back(
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<ARGS>(args)...));
+            return { std::prev(elements_.end()), true };
+        }
+
+        // The elements after the new one cannot be shifted by assignment, so
+        // they are rebuilt around it. The new one is made first in case args
+        // refer to the existing ones.
+        std::pair<KEY, VALUE> element(
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<ARGS>(args)...));
+        auto           index = iter - elements_.begin();
+        container_type rebuilt;
+        rebuilt.reserve(std::max(elements_.capacity(), elements_.size() + 1));
+        std::move(elements_.begin(), iter, std::back_inserter(rebuilt));
+        rebuilt.emplace_back(std::move(element.first),
+                             std::move(element.second));
+        std::move(iter, elements_.end(), std::back_inserter(rebuilt));
+        elements_.swap(rebuilt);
+        return { elements_.begin() + index, true };
+    }
+
+    template<typename K, typename V>
+    std::pair<iterator, bool> emplace(K&& key, V&& value)
+    {
+        return try_emplace(std::forward<K>(key), std::forward<V>(value));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    template<typename K, typename V>
+    std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+    {
+        auto result = try_emplace(std::forward<K>(key), std::forward<V>(value));
+        if (!result.second) {
+            result.first->second = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    mapped_type& operator[](const key_type& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    mapped_type& operator[](key_type&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template<typename K>
+    mapped_type& at(const K& key)
+    {
+        auto iter = find(key);
+        if (iter == end()) { throw std::out_of_range("FlatMap::at"); }
+        return iter->second;
+    }
+
+    template<typename K>
+    const mapped_type& at(const K& key) const
+    {
+        auto iter = find(key);
+        if (iter == end()) { throw std::out_of_range("FlatMap::at"); }
+        return iter->second;
+    }
+
+    template<typename K>
+    iterator find(const K& key)
+    {
+        auto iter = LowerBound(key);
+        return iter != elements_.end() && !(key < iter->first) ? iter : end();
+    }
+
+    template<typename K>
+    const_iterator find(const K& key) const
+    {
+        return const_cast<FlatMap*>(this)->find(key);
+    }
+
+    template<typename K>
+    size_type count(const K& key) const
+    {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    iterator erase(const_iterator pos)
+    {
+        auto index = pos - elements_.cbegin();
+        if (std::next(pos) == elements_.cend()) {
+            elements_.pop_back();
+            return elements_.end();
+        }
+
+        // Rebuilt without the erased one for the same reason as insertion.
+        container_type rebuilt;
+        rebuilt.reserve(elements_.capacity());
+        std::move(elements_.cbegin(), pos, std::back_inserter(rebuilt));
+        std::move(std::next(pos), elements_.cend(), std::back_inserter(rebuilt));
+        elements_.swap(rebuilt);
+        return elements_.begin() + index;
+    }
+
+    template<typename K>
+    size_type erase(const K& key)
+    {
+        auto iter = find(key);
+        if (iter == end()) { return 0; }
+        erase(const_iterator(iter));
+        return 1;
+    }
+
+    friend bool operator==(const FlatMap& lhs, const FlatMap& rhs)
+    {
+        return lhs.elements_ == rhs.elements_;
+    }
+
+    friend bool operator!=(const FlatMap& lhs, const FlatMap& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    template<typename K>
+    iterator LowerBound(const K& key)
+    {
+        return std::lower_bound(elements_.begin(),
+                                elements_.end(),
+                                key,
+                                [](const value_type& element, const K& key) {
+                                    return element.first < key;
+                                });
+    }
+
+private:
+    container_type elements_;
+};
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_FLATMAP_HPP
@@ -16,10 +16,10 @@
 #define OPENGEMINI_POINT_HPP
 
 #include <chrono>
-#include <map>
 #include <string>
 #include <variant>
 
+#include "opengemini/FlatMap.hpp"
 #include "opengemini/Precision.hpp"
 
 namespace opengemini {
@@ -27,20 +27,23 @@ namespace opengemini {
 ///
 /// \~English
 /// @brief Holds the point data.
+/// @details Fields and tags are kept sorted by key in contiguous storage,
+/// see @ref FlatMap .
 ///
 /// \~Chinese
 /// @brief 点位数据。
+/// @details 字段及标签按键排序后存放于连续内存中，参考 @ref FlatMap 。
 ///
 struct Point {
     using Field = std::variant<double, int64_t, uint64_t, std::string, bool>;
     using Time  = std::chrono::time_point<std::chrono::system_clock,
                                          std::chrono::nanoseconds>;
 
-    std::string                        measurement;
-    std::map<std::string, Field>       fields;
-    Time                               time;
-    std::map<std::string, std::string> tags;
-    Precision                          precision{ Precision::Nanosecond };
+    std::string                       measurement;
+    FlatMap<std::string, Field>       fields;
+    Time                              time;
+    FlatMap<std::string, std::string> tags;
+    Precision                         precision{ Precision::Nanosecond };
 };
 
 } // namespace opengemini
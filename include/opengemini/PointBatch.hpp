@@ -0,0 +1,57 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_POINTBATCH_HPP
+#define OPENGEMINI_POINTBATCH_HPP
+
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "opengemini/FlatMap.hpp"
+#include "opengemini/Point.hpp"
+#include "opengemini/Precision.hpp"
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief Holds the points of one series in columns.
+/// @details The i-th point consists of times[i] and the i-th value of every
+/// field column, all points share the same measurement and tags. Every field
+/// column must have as many values as times.
+///
+/// \~Chinese
+/// @brief 按列存放同一序列的多个点位。
+/// @details 第i个点位由times[i]及每个字段列的第i个值组成，
+/// 所有点位共享相同的度量及标签。每个字段列的值数量必须与times相同。
+///
+struct PointBatch {
+    using Column = std::variant<std::vector<double>,
+                                std::vector<int64_t>,
+                                std::vector<uint64_t>,
+                                std::vector<std::string>,
+                                std::vector<bool>>;
+
+    std::string                       measurement;
+    FlatMap<std::string, Column>      fields;
+    std::vector<Point::Time>          times;
+    FlatMap<std::string, std::string> tags;
+    Precision                         precision{ Precision::Nanosecond };
+};
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_POINTBATCH_HPP
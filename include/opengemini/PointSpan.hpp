@@ -0,0 +1,84 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_POINTSPAN_HPP
+#define OPENGEMINI_POINTSPAN_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "opengemini/Point.hpp"
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief A view of contiguous points owned by the caller, like
+/// @code std::span<const Point> @endcode of C++20.
+/// @details The span does not copy the points, they must outlive any use of
+/// the span.
+///
+/// \~Chinese
+/// @brief 调用者所持有的连续点位的视图，类似C++20的
+/// @code std::span<const Point> @endcode 。
+/// @details 该视图不拷贝点位，点位的生命周期必须长于对视图的使用。
+///
+class PointSpan {
+public:
+    using value_type     = Point;
+    using const_iterator = const Point*;
+
+public:
+    constexpr PointSpan() noexcept = default;
+
+    constexpr PointSpan(const Point* data, std::size_t size) noexcept :
+        data_(data),
+        size_(size)
+    { }
+
+    PointSpan(const std::vector<Point>& points) noexcept :
+        data_(points.data()),
+        size_(points.size())
+    { }
+
+    template<std::size_t SIZE>
+    constexpr PointSpan(const Point (&points)[SIZE]) noexcept :
+        data_(points),
+        size_(SIZE)
+    { }
+
+    constexpr const Point* data() const noexcept { return data_; }
+
+    constexpr std::size_t size() const noexcept { return size_; }
+
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr const_iterator begin() const noexcept { return data_; }
+
+    constexpr const_iterator end() const noexcept { return data_ + size_; }
+
+    constexpr const Point& operator[](std::size_t idx) const noexcept
+    {
+        return data_[idx];
+    }
+
+private:
+    const Point* data_{ nullptr };
+    std::size_t  size_{ 0 };
+};
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_POINTSPAN_HPP
@@ -15,6 +15,7 @@
 #ifndef OPENGEMINI_QUERY_HPP
 #define OPENGEMINI_QUERY_HPP
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -102,6 +103,15 @@ struct QueryResult {
     std::string               error;
 };
 
+///
+/// \~English
+/// @brief Receives the series of a chunked query one at a time.
+///
+/// \~Chinese
+/// @brief 逐个接收分块查询返回的时序数据。
+///
+using SeriesHandler = std::function<void(Series series)>;
+
 } // namespace opengemini
 
 #include "opengemini/impl/Query.ipp"
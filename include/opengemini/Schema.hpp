@@ -0,0 +1,228 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_SCHEMA_HPP
+#define OPENGEMINI_SCHEMA_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "opengemini/Point.hpp"
+#include "opengemini/Precision.hpp"
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief Describes how a user defined record type is written as a point.
+/// @details Specialize it for a record type with a fixed measurement, tag set
+/// and field set, then vectors of such records can be passed to @ref
+/// Client::Write . The escaped keys are computed at compile time, and every
+/// member is encoded according to its static type, without looking up or
+/// dispatching on anything at runtime. The specialization must provide:
+/// - measurement: a @ref schema::Measurement ;
+/// - tags: a std::tuple of @ref schema::Tag , which may be empty. Sorting the
+///   tags by key saves the server from doing it;
+/// - fields: a non-empty std::tuple of @ref schema::Field ;
+/// - time: a pointer to the data member of type @ref Point::Time , a
+///   default-initialized time means the time is assigned by the server;
+/// - precision (optional): a @ref Precision , default to nanosecond.
+/// @code
+/// struct Cpu {
+///     std::string host;
+///     double      usage;
+///     int64_t     processes;
+///     Point::Time time;
+/// };
+///
+/// namespace opengemini {
+/// template<>
+/// struct Schema<Cpu> {
+///     static constexpr auto measurement = schema::Measurement("cpu");
+///     static constexpr auto tags =
+///         std::make_tuple(schema::Tag("host", &Cpu::host));
+///     static constexpr auto fields =
+///         std::make_tuple(schema::Field("usage", &Cpu::usage),
+///                         schema::Field("processes", &Cpu::processes));
+///     static constexpr auto time = &Cpu::time;
+/// };
+/// } // namespace opengemini
+/// @endcode
+///
+/// \~Chinese
+/// @brief 描述用户自定义的记录类型如何作为点位写入。
+/// @details 为具有固定度量、标签集及字段集的记录类型特化该模板后，
+/// 即可将该类型的记录数组传递给 @ref Client::Write 。
+/// 转义后的键在编译期完成计算，每个成员均按其静态类型编码，
+/// 运行时无需任何查找或分派。特化必须提供：
+/// - measurement：@ref schema::Measurement ；
+/// - tags：由 @ref schema::Tag 组成的std::tuple，可以为空。
+///   按键对标签排序可免去服务端的排序工作；
+/// - fields：由 @ref schema::Field 组成的非空std::tuple；
+/// - time：指向类型为 @ref Point::Time 的数据成员的指针，
+///   默认初始化的时间代表由服务端指定时间；
+/// - precision（可选）：@ref Precision ，默认为纳秒。
+/// 示例参考英文文档。
+///
+template<typename RECORD>
+struct Schema;
+
+///
+/// \~English
+/// @brief Whether @ref Schema is specialized for the type.
+///
+/// \~Chinese
+/// @brief 类型是否特化了 @ref Schema 。
+///
+template<typename RECORD, typename = void>
+struct HasSchema : std::false_type { };
+
+template<typename RECORD>
+struct HasSchema<RECORD, std::void_t<decltype(Schema<RECORD>::measurement)>> :
+    std::true_type { };
+
+template<typename RECORD>
+inline constexpr auto HasSchema_v = HasSchema<RECORD>::value;
+
+namespace schema {
+
+namespace detail {
+
+inline constexpr std::string_view ESCAPE_CHARS_MEASUREMENT{ ", " };
+inline constexpr std::string_view ESCAPE_CHARS_KEY{ ",= " };
+
+// A key escaped at compile time, SIZE is the size of the string literal of the
+// key, including the null terminator.
+template<std::size_t SIZE>
+class EscapedKey {
+public:
+    constexpr EscapedKey(const char (&key)[SIZE],
+                         std::string_view escapes,
+                         std::string_view prefix,
+                         std::string_view suffix)
+    {
+        for (auto ch : prefix) { data_[size_++] = ch; }
+        for (std::size_t idx = 0; idx + 1 < SIZE; ++idx) {
+            for (auto escape : escapes) {
+                if (key[idx] == escape) { data_[size_++] = '\\'; }
+            }
+            data_[size_++] = key[idx];
+        }
+        for (auto ch : suffix) { data_[size_++] = ch; }
+    }
+
+    constexpr std::string_view View() const noexcept
+    {
+        return { data_, size_ };
+    }
+
+private:
+    // Every char may be escaped, plus a char of prefix and suffix each.
+    char        data_[2 * SIZE]{};
+    std::size_t size_{ 0 };
+};
+
+} // namespace detail
+
+///
+/// \~English
+/// @brief The measurement of @ref Schema .
+///
+/// \~Chinese
+/// @brief @ref Schema 的度量。
+///
+template<std::size_t SIZE>
+struct Measurement {
+    static_assert(SIZE > 1, "The measurement must not be empty");
+
+    constexpr explicit Measurement(const char (&name)[SIZE]) :
+        escaped(name, detail::ESCAPE_CHARS_MEASUREMENT, {}, {})
+    { }
+
+    // Escaped name.
+    detail::EscapedKey<SIZE> escaped;
+};
+
+///
+/// \~English
+/// @brief A tag of @ref Schema , which takes its value from a data member of
+/// the record convertible to std::string_view.
+///
+/// \~Chinese
+/// @brief @ref Schema 的标签，其值取自记录中可转换为std::string_view的数据成员。
+///
+template<std::size_t SIZE, typename MEMBER>
+struct Tag {
+    static_assert(SIZE > 1, "The key of a tag must not be empty");
+
+    constexpr Tag(const char (&key)[SIZE], MEMBER member) :
+        escaped(key, detail::ESCAPE_CHARS_KEY, ",", "="),
+        member(member)
+    { }
+
+    // Escaped key in the form of ",key=".
+    detail::EscapedKey<SIZE> escaped;
+    MEMBER                   member;
+};
+
+///
+/// \~English
+/// @brief A field of @ref Schema , which takes its value from a data member of
+/// the record. Its type decides the type of the field: bool as boolean, other
+/// signed and unsigned integers as integer and unsigned integer respectively,
+/// floating point as float, and types convertible to std::string_view as
+/// string. Character types such as char are rejected at compile time, use
+/// std::int8_t or std::uint8_t for one-byte integers.
+///
+/// \~Chinese
+/// @brief @ref Schema 的字段，其值取自记录的数据成员。
+/// 成员的类型决定字段的类型：bool为布尔值，
+/// 其他有符号及无符号整数分别为整数及无符号整数，浮点数为浮点数，可转换为std::string_view的类型为字符串。
+/// char等字符类型将在编译时被拒绝，单字节整数请使用std::int8_t或std::uint8_t。
+///
+template<std::size_t SIZE, typename MEMBER>
+struct Field {
+    static_assert(SIZE > 1, "The key of a field must not be empty");
+
+    constexpr Field(const char (&key)[SIZE], MEMBER member) :
+        escaped(key, detail::ESCAPE_CHARS_KEY, ",", "="),
+        member(member)
+    { }
+
+    // Escaped key in the form of ",key=".
+    detail::EscapedKey<SIZE> escaped;
+    MEMBER                   member;
+};
+
+namespace detail {
+
+// The precision of a schema, which is optional.
+template<typename SCHEMA, typename = void>
+struct PrecisionOf :
+    std::integral_constant<Precision, Precision::Nanosecond> { };
+
+template<typename SCHEMA>
+struct PrecisionOf<SCHEMA, std::void_t<decltype(SCHEMA::precision)>> :
+    std::integral_constant<Precision, SCHEMA::precision> { };
+
+} // namespace detail
+
+} // namespace schema
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_SCHEMA_HPP
@@ -0,0 +1,55 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file SeriesCacheStats.hpp
+#ifndef OPENGEMINI_SERIESCACHESTATS_HPP
+#define OPENGEMINI_SERIESCACHESTATS_HPP
+
+#include <cstdint>
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief Counters of the series cache.
+/// @see ClientConfig::seriesCacheCapacity
+///
+/// \~Chinese
+/// @brief 序列缓存计数。
+/// @see ClientConfig::seriesCacheCapacity
+///
+struct SeriesCacheStats {
+    ///
+    /// \~English
+    /// @brief Number of points whose measurement and tags were found in cache.
+    ///
+    /// \~Chinese
+    /// @brief 度量及标签命中缓存的点位数量。
+    ///
+    std::uint64_t hits{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Number of points whose measurement and tags were not found in
+    /// cache and had to be encoded.
+    ///
+    /// \~Chinese
+    /// @brief 度量及标签未命中缓存而需要编码的点位数量。
+    ///
+    std::uint64_t misses{ 0 };
+};
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_SERIESCACHESTATS_HPP
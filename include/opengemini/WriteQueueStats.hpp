@@ -0,0 +1,87 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/// @file WriteQueueStats.hpp
+#ifndef OPENGEMINI_WRITEQUEUESTATS_HPP
+#define OPENGEMINI_WRITEQUEUESTATS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opengemini {
+
+///
+/// \~English
+/// @brief Counters of the writes held by the client.
+/// @see ClientConfig::backpressureConfig
+///
+/// \~Chinese
+/// @brief 客户端所持有写入的计数。
+/// @see ClientConfig::backpressureConfig
+///
+struct WriteQueueStats {
+    ///
+    /// \~English
+    /// @brief Number of write requests being sent.
+    ///
+    /// \~Chinese
+    /// @brief 正在发送的写请求数量。
+    ///
+    std::size_t inflightRequests{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Number of writes waiting in queue to be sent.
+    ///
+    /// \~Chinese
+    /// @brief 在队列中等待发送的写入数量。
+    ///
+    std::size_t queuedRequests{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Estimated total size in bytes of the writes being sent or
+    /// waiting in queue.
+    ///
+    /// \~Chinese
+    /// @brief 正在发送及在队列中等待的写入的估算总字节数。
+    ///
+    std::size_t inflightBytes{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Number of writes failed with @ref
+    /// errc::RuntimeErrors::WriteQueueFull so far.
+    ///
+    /// \~Chinese
+    /// @brief 迄今以 @ref errc::RuntimeErrors::WriteQueueFull
+    /// 错误结束的写入数量。
+    ///
+    std::uint64_t rejected{ 0 };
+
+    ///
+    /// \~English
+    /// @brief Number of writes failed with @ref
+    /// errc::RuntimeErrors::WriteDropped so far.
+    ///
+    /// \~Chinese
+    /// @brief 迄今以 @ref errc::RuntimeErrors::WriteDropped 错误结束的写入数量。
+    ///
+    std::uint64_t dropped{ 0 };
+};
+
+} // namespace opengemini
+
+#endif // !OPENGEMINI_WRITEQUEUESTATS_HPP
@@ -0,0 +1,135 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_WRITER_HPP
+#define OPENGEMINI_WRITER_HPP
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "opengemini/CompletionToken.hpp"
+#include "opengemini/Point.hpp"
+#include "opengemini/PointSpan.hpp"
+
+namespace opengemini {
+
+namespace impl {
+class ClientImpl;
+namespace cli {
+struct WriteTarget;
+}
+} // namespace impl
+
+///
+/// \~English
+/// @brief Writes points to a retention policy of a database bound beforehand.
+/// @details Created by @ref Client::BindWriter , the names are
+/// percent-encoded and the request target is built only once and reused by
+/// every write, instead of being built for each of them. A writer can be
+/// copied cheaply, and must not be used after the client it comes from is
+/// destroyed.
+///
+/// \~Chinese
+/// @brief 向预先绑定的数据库保留策略写入点位。
+/// @details 由 @ref Client::BindWriter
+/// 创建，名称的百分号编码及请求目标仅构建一次并被每次写入复用，
+/// 而不是为每次写入分别构建。写入器的拷贝开销很小，
+/// 且在创建它的客户端销毁后不能再被使用。
+///
+class Writer {
+public:
+    ///
+    /// \~English
+    /// @brief Write a point.
+    /// @param point A single point.
+    /// @param token The completion token which will be invoked when the task
+    /// complete, same as the one of @ref Client::Write .
+    ///
+    /// \~Chinese
+    /// @brief 写入一个点位。
+    /// @param point 单个点位。
+    /// @param token 任务完成令牌，与 @ref Client::Write 的相同。
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Write(Point point, COMPLETION_TOKEN&& token = {}) const;
+
+    ///
+    /// \~English
+    /// @brief Write multiple points.
+    /// @param points A vector of points.
+    /// @param token The completion token which will be invoked when the task
+    /// complete, same as the one of @ref Client::Write .
+    ///
+    /// \~Chinese
+    /// @brief 写入多个点位。
+    /// @param points 点位数组。
+    /// @param token 任务完成令牌，与 @ref Client::Write 的相同。
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Write(std::vector<Point> points,
+                             COMPLETION_TOKEN&& token = {}) const;
+
+    ///
+    /// \~English
+    /// @brief Write multiple points held by the caller without copying them.
+    /// @param points A view of the points, see @ref PointSpan .
+    /// @param token The completion token which will be invoked when the task
+    /// complete, only @ref token::sync and @ref token::coro are accepted.
+    ///
+    /// \~Chinese
+    /// @brief 写入调用者持有的多个点位，不对点位进行拷贝。
+    /// @param points 点位的视图，参考 @ref PointSpan 。
+    /// @param token 任务完成令牌，仅接受 @ref token::sync 和 @ref
+    /// token::coro 。
+    ///
+    template<typename COMPLETION_TOKEN = token::Sync>
+    [[nodiscard]] auto Write(PointSpan          points,
+                             COMPLETION_TOKEN&& token = {}) const;
+
+    ///
+    /// \~English
+    /// @brief Get the name of the bound database.
+    ///
+    /// \~Chinese
+    /// @brief 获取所绑定的数据库名称。
+    ///
+    std::string_view Database() const noexcept;
+
+    ///
+    /// \~English
+    /// @brief Get the name of the bound retention policy.
+    ///
+    /// \~Chinese
+    /// @brief 获取所绑定的保留策略名称。
+    ///
+    std::string_view RetentionPolicy() const noexcept;
+
+private:
+    friend class Client;
+
+    Writer(impl::ClientImpl&                             impl,
+           std::shared_ptr<const impl::cli::WriteTarget> target);
+
+private:
+    impl::ClientImpl*                             impl_;
+    std::shared_ptr<const impl::cli::WriteTarget> target_;
+};
+
+} // namespace opengemini
+
+#include "opengemini/impl/Writer.ipp"
+
+#endif // !OPENGEMINI_WRITER_HPP
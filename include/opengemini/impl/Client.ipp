@@ -16,7 +16,9 @@
 
 #include <cassert>
 
+#include "opengemini/Exception.hpp"
 #include "opengemini/impl/ClientImpl.hpp"
+#include "opengemini/impl/util/TypeTraits.hpp"
 
 namespace opengemini {
 
@@ -34,6 +36,35 @@ inline Client& Client::operator=(Client&& client) noexcept
     return *this;
 }
 
+inline Writer Client::BindWriter(std::string_view database,
+                                 std::string_view retentionPolicy)
+{
+    if (database.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Database name cannot be empty");
+    }
+
+    return { *impl_,
+             std::make_shared<const impl::cli::WriteTarget>(
+                 std::string(database),
+                 std::string(retentionPolicy)) };
+}
+
+inline struct SeriesCacheStats Client::SeriesCacheStats() const
+{
+    return impl_->SeriesCacheStats();
+}
+
+inline struct WriteQueueStats Client::WriteQueueStats() const
+{
+    return impl_->WriteQueueStats();
+}
+
+inline struct BatchStats Client::BatchStats() const
+{
+    return impl_->BatchStats();
+}
+
 template<typename COMPLETION_TOKEN>
 auto Client::Ping(std::size_t index, COMPLETION_TOKEN&& token)
 {
@@ -47,6 +78,28 @@ auto Client::Query(struct Query query, COMPLETION_TOKEN&& token)
                         std::forward<COMPLETION_TOKEN>(token));
 }
 
+template<typename COMPLETION_TOKEN>
+auto Client::Query(struct Query       query,
+                   format::Columnar   format,
+                   COMPLETION_TOKEN&& token)
+{
+    return impl_->Query(std::move(query),
+                        format,
+                        std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Client::QueryChunked(struct Query       query,
+                          std::size_t        chunkSize,
+                          SeriesHandler      handler,
+                          COMPLETION_TOKEN&& token)
+{
+    return impl_->QueryChunked(std::move(query),
+                               chunkSize,
+                               std::move(handler),
+                               std::forward<COMPLETION_TOKEN>(token));
+}
+
 template<typename COMPLETION_TOKEN>
 auto Client::CreateDatabase(std::string_view        database,
                             std::optional<RpConfig> rpConfig,
@@ -124,4 +177,106 @@ auto Client::Write(std::string_view   database,
         std::forward<COMPLETION_TOKEN>(token));
 }
 
+template<typename COMPLETION_TOKEN>
+auto Client::Write(std::string_view   database,
+                   PointSpan          points,
+                   std::string_view   retentionPolicy,
+                   COMPLETION_TOKEN&& token)
+{
+    static_assert(util::IsWaitingToken_v<COMPLETION_TOKEN>,
+                  "Borrowed points can only be written with token::sync or "
+                  "token::coro");
+
+    return impl_->Write<PointSpan>(database,
+                                   points,
+                                   retentionPolicy,
+                                   std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Client::Write(std::string_view   database,
+                   const Point*       points,
+                   std::size_t        count,
+                   std::string_view   retentionPolicy,
+                   COMPLETION_TOKEN&& token)
+{
+    return Write(database,
+                 PointSpan{ points, count },
+                 retentionPolicy,
+                 std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Client::Write(std::string_view   database,
+                   PointBatch         batch,
+                   std::string_view   retentionPolicy,
+                   COMPLETION_TOKEN&& token)
+{
+    return impl_->Write<PointBatch>(database,
+                                    std::move(batch),
+                                    retentionPolicy,
+                                    std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename RECORD, typename COMPLETION_TOKEN, typename>
+auto Client::Write(std::string_view    database,
+                   std::vector<RECORD> records,
+                   std::string_view    retentionPolicy,
+                   COMPLETION_TOKEN&&  token)
+{
+    return impl_->Write<std::vector<RECORD>>(
+        database,
+        std::move(records),
+        retentionPolicy,
+        std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Client::WriteRaw(std::string_view   database,
+                      std::string        body,
+                      std::string_view   retentionPolicy,
+                      bool               validate,
+                      COMPLETION_TOKEN&& token)
+{
+    auto owner = std::make_shared<const std::string>(std::move(body));
+    auto view  = std::string_view(*owner);
+    return WriteRaw(database,
+                    view,
+                    std::move(owner),
+                    retentionPolicy,
+                    validate,
+                    std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Client::WriteRaw(std::string_view            database,
+                      std::string_view            body,
+                      std::shared_ptr<const void> owner,
+                      std::string_view            retentionPolicy,
+                      bool                        validate,
+                      COMPLETION_TOKEN&&          token)
+{
+    return WriteRaw(database,
+                    std::vector<std::string_view>{ body },
+                    std::move(owner),
+                    retentionPolicy,
+                    validate,
+                    std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Client::WriteRaw(std::string_view              database,
+                      std::vector<std::string_view> buffers,
+                      std::shared_ptr<const void>   owner,
+                      std::string_view              retentionPolicy,
+                      bool                          validate,
+                      COMPLETION_TOKEN&&            token)
+{
+    return impl_->Write<impl::cli::RawBody>(
+        database,
+        { std::move(buffers), std::move(owner), validate },
+        retentionPolicy,
+        std::forward<COMPLETION_TOKEN>(token));
+}
+
 } // namespace opengemini
@@ -71,6 +71,14 @@ ClientConfigBuilder::BatchConfig(std::chrono::milliseconds interval,
     return *this;
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder&
+ClientConfigBuilder::BatchConfig(const struct BatchConfig& config)
+{
+    conf_.batchConfig.emplace(config);
+    return *this;
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 ClientConfigBuilder&
 ClientConfigBuilder::ReadWriteTimeout(std::chrono::milliseconds timeout)
@@ -94,6 +102,17 @@ ClientConfigBuilder& ClientConfigBuilder::EnableGzip(bool enabled)
     return *this;
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder& ClientConfigBuilder::GzipConfig(int         level,
+                                                     std::size_t minBodySize)
+{
+    struct GzipConfig gzip {
+        level, minBodySize
+    };
+    conf_.gzipConfig.emplace(std::move(gzip));
+    return *this;
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 ClientConfigBuilder& ClientConfigBuilder::ConcurrencyHint(std::size_t hint)
 {
@@ -101,6 +120,70 @@ ClientConfigBuilder& ClientConfigBuilder::ConcurrencyHint(std::size_t hint)
     return *this;
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder&
+ClientConfigBuilder::ParallelEncodeThreshold(std::size_t threshold)
+{
+    conf_.parallelEncodeThreshold = threshold;
+    return *this;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder&
+ClientConfigBuilder::SeriesCacheCapacity(std::size_t capacity)
+{
+    conf_.seriesCacheCapacity = capacity;
+    return *this;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder&
+ClientConfigBuilder::BackpressureConfig(std::size_t    maxInflightRequests,
+                                        std::size_t    maxQueuedRequests,
+                                        std::size_t    maxInflightBytes,
+                                        OverflowPolicy policy)
+{
+    struct BackpressureConfig backpressure {
+        maxInflightRequests, maxQueuedRequests, maxInflightBytes, policy
+    };
+    conf_.backpressureConfig.emplace(std::move(backpressure));
+    return *this;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder&
+ClientConfigBuilder::SpillConfig(std::string directory,
+                                 std::size_t maxDiskBytes,
+                                 std::size_t segmentBytes,
+                                 std::size_t replayBytesPerSecond)
+{
+    struct SpillConfig spill {
+        std::move(directory), maxDiskBytes, segmentBytes, replayBytesPerSecond
+    };
+    conf_.spillConfig.emplace(std::move(spill));
+    return *this;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder&
+ClientConfigBuilder::WriteRouting(enum WriteRouting routing)
+{
+    conf_.writeRouting = routing;
+    return *this;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ClientConfigBuilder& ClientConfigBuilder::ReplicationConfig(
+    std::vector<std::vector<Endpoint>> replicas,
+    AckPolicy                          policy)
+{
+    struct ReplicationConfig replication {
+        std::move(replicas), policy
+    };
+    conf_.replicationConfig.emplace(std::move(replication));
+    return *this;
+}
+
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
 OPENGEMINI_INLINE_SPECIFIER
 ClientConfigBuilder& ClientConfigBuilder::SkipVerifyPeer(bool skipped)
@@ -14,9 +14,12 @@
 
 #include "opengemini/impl/ClientImpl.hpp"
 
+#include <filesystem>
+
 #include <fmt/format.h>
 
 #include "opengemini/Exception.hpp"
+#include "opengemini/impl/comm/UrlTargets.hpp"
 #include "opengemini/impl/http/HttpClient.hpp"
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
 #    include "opengemini/impl/http/HttpsClient.hpp"
@@ -29,19 +32,56 @@ namespace opengemini::impl {
 OPENGEMINI_INLINE_SPECIFIER
 ClientImpl::ClientImpl(const ClientConfig& config) :
     ctx_(config.concurrencyHint),
+    encoder_(ctx_(), config.parallelEncodeThreshold, ctx_.Concurrency()),
+    cache_(ConstructSeriesCache(config)),
+    limiter_(ConstructWriteLimiter(config)),
     http_(ConstructHttpClient(config)),
-    lb_(lb::LoadBalancer::Construct(ctx_(), config.addresses, http_))
+    lb_(lb::LoadBalancer::Construct(ctx_(), config.addresses, http_)),
+    spill_(ConstructSpillQueue(config, lb_)),
+    batch_(ConstructBatchWriter(config)),
+    routeBySeries_(config.writeRouting == WriteRouting::BySeries)
 {
+    ConstructReplication(config);
+
     lb_->StartHealthCheck();
+    if (spill_) { spill_->StartReplay(); }
+    for (auto& lb : replicaLbs_) { lb->StartHealthCheck(); }
+    for (auto& spill : replicaSpills_) { spill->StartReplay(); }
 }
 
 OPENGEMINI_INLINE_SPECIFIER
 ClientImpl::~ClientImpl()
 {
+    if (batch_) { batch_->Stop(); }
+    if (limiter_) { limiter_->Stop(); }
+    if (spill_) { spill_->StopReplay(); }
+    for (auto& spill : replicaSpills_) { spill->StopReplay(); }
     lb_->StopHealthCheck();
+    for (auto& lb : replicaLbs_) { lb->StopHealthCheck(); }
     ctx_.Shutdown();
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+struct SeriesCacheStats ClientImpl::SeriesCacheStats() const
+{
+    if (!cache_) { return {}; }
+    return { cache_->Hits(), cache_->Misses() };
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+struct WriteQueueStats ClientImpl::WriteQueueStats() const
+{
+    if (!limiter_) { return {}; }
+    return limiter_->Stats();
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+struct BatchStats ClientImpl::BatchStats() const
+{
+    if (!batch_) { return {}; }
+    return batch_->Stats();
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 std::shared_ptr<http::IHttpClient>
 ClientImpl::ConstructHttpClient(const ClientConfig& config)
@@ -63,6 +103,10 @@ ClientImpl::ConstructHttpClient(const ClientConfig& config)
                                                   config.timeout);
     }
 
+    if (config.gzipEnabled) {
+        http->EnableGzip(config.gzipConfig.value_or(GzipConfig{}));
+    }
+
     if (auto& auth = config.authConfig; auth.has_value()) {
         auto val = std::get_if<AuthCredential>(&auth.value());
         if (!val) {
@@ -78,4 +122,116 @@ ClientImpl::ConstructHttpClient(const ClientConfig& config)
     return http;
 };
 
+OPENGEMINI_INLINE_SPECIFIER
+std::unique_ptr<enc::SeriesCache>
+ClientImpl::ConstructSeriesCache(const ClientConfig& config)
+{
+    if (config.seriesCacheCapacity == 0) { return nullptr; }
+
+    return std::make_unique<enc::SeriesCache>(config.seriesCacheCapacity);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::unique_ptr<WriteLimiter>
+ClientImpl::ConstructWriteLimiter(const ClientConfig& config)
+{
+    if (!config.backpressureConfig.has_value()) { return nullptr; }
+
+    return std::make_unique<WriteLimiter>(ctx_(),
+                                          config.backpressureConfig.value());
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::shared_ptr<spill::SpillQueue>
+ClientImpl::ConstructSpillQueue(const ClientConfig&               config,
+                                std::shared_ptr<lb::LoadBalancer> lb,
+                                std::string_view                  subdirectory)
+{
+    if (!config.spillConfig.has_value()) { return nullptr; }
+
+    auto spillConfig = config.spillConfig.value();
+    if (!subdirectory.empty()) {
+        spillConfig.directory =
+            (std::filesystem::path(spillConfig.directory) / subdirectory)
+                .string();
+    }
+    return spill::SpillQueue::Construct(
+        ctx_(),
+        spillConfig,
+        [this, lb = std::move(lb)](const spill::SpillQueue::Entry& entry,
+                                   boost::asio::yield_context      yield) {
+            auto target = url::WriteTarget(entry.database,
+                                           entry.retentionPolicy);
+            url::AppendPrecision(target, entry.precision);
+
+            Error error;
+            auto  rsp = http_->Post(lb->PickAvailableServer(),
+                                   target,
+                                   entry.body,
+                                   yield,
+                                   error);
+            // Retries later if the server is unreachable or fails, a write
+            // rejected by the server is dropped as it would never succeed.
+            return !error && rsp.result_int() < 500;
+        });
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void ClientImpl::ConstructReplication(const ClientConfig& config)
+{
+    if (!config.replicationConfig.has_value()) { return; }
+
+    auto& replication = config.replicationConfig.value();
+    std::vector<cli::Replication::Group> groups{ { *lb_, spill_.get() } };
+    for (std::size_t idx = 0; idx < replication.replicas.size(); ++idx) {
+        auto lb = lb::LoadBalancer::Construct(ctx_(),
+                                              replication.replicas[idx],
+                                              http_);
+        auto spill = ConstructSpillQueue(config,
+                                         lb,
+                                         fmt::format("replica-{}", idx + 1));
+        groups.push_back({ *lb, spill.get() });
+        replicaLbs_.push_back(std::move(lb));
+        if (spill) { replicaSpills_.push_back(std::move(spill)); }
+    }
+
+    std::size_t acks{ groups.size() };
+    if (replication.ackPolicy == AckPolicy::Quorum) {
+        acks = groups.size() / 2 + 1;
+    }
+    else if (replication.ackPolicy == AckPolicy::Any) {
+        acks = 1;
+    }
+    replication_.emplace(cli::Replication{ std::move(groups),
+                                           acks,
+                                           replication.retries,
+                                           replication.retryInterval });
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::shared_ptr<batch::BatchWriter>
+ClientImpl::ConstructBatchWriter(const ClientConfig& config)
+{
+    if (!config.batchConfig.has_value()) { return nullptr; }
+
+    return batch::BatchWriter::Construct(
+        ctx_(),
+        config.batchConfig.value(),
+        [this](batch::BatchWriter::Target  target,
+               std::vector<Point>          points,
+               batch::BatchWriter::Handler handler) {
+            SpawnWrite(
+                cli::RunWrite<std::vector<Point>>{
+                    { *http_, *lb_ },
+                    std::move(target),
+                    std::move(points),
+                    &encoder_,
+                    cache_.get(),
+                    spill_.get(),
+                    routeBySeries_,
+                    replication_ ? &replication_.value() : nullptr },
+                std::move(handler));
+        });
+}
+
 } // namespace opengemini::impl
@@ -16,14 +16,27 @@
 #define OPENGEMINI_IMPL_CLIENTIMPL_HPP
 
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
+#include "opengemini/BatchStats.hpp"
 #include "opengemini/ClientConfig.hpp"
+#include "opengemini/ColumnarResult.hpp"
 #include "opengemini/Query.hpp"
 #include "opengemini/RetentionPolicy.hpp"
+#include "opengemini/SeriesCacheStats.hpp"
+#include "opengemini/WriteQueueStats.hpp"
+#include "opengemini/impl/batch/BatchWriter.hpp"
+#include "opengemini/impl/cli/write/Write.hpp"
 #include "opengemini/impl/comm/Context.hpp"
+#include "opengemini/impl/comm/WriteLimiter.hpp"
+#include "opengemini/impl/enc/ParallelEncoder.hpp"
+#include "opengemini/impl/enc/SeriesCache.hpp"
 #include "opengemini/impl/http/IHttpClient.hpp"
 #include "opengemini/impl/lb/LoadBalancer.hpp"
+#include "opengemini/impl/spill/SpillQueue.hpp"
 #include "opengemini/impl/util/TypeTraits.hpp"
 
 namespace opengemini::impl {
@@ -39,6 +52,17 @@ public:
     template<typename COMPLETION_TOKEN>
     auto Query(struct Query query, COMPLETION_TOKEN&& token);
 
+    template<typename COMPLETION_TOKEN>
+    auto Query(struct Query       query,
+               format::Columnar   format,
+               COMPLETION_TOKEN&& token);
+
+    template<typename COMPLETION_TOKEN>
+    auto QueryChunked(struct Query       query,
+                      std::size_t        chunkSize,
+                      SeriesHandler      handler,
+                      COMPLETION_TOKEN&& token);
+
     template<typename COMPLETION_TOKEN>
     auto CreateDatabase(std::string_view        database,
                         std::optional<RpConfig> rpConfig,
@@ -71,10 +95,43 @@ public:
                std::string_view   retentionPolicy,
                COMPLETION_TOKEN&& token);
 
+    // Writes to the target built beforehand, see Client::BindWriter().
+    template<typename POINT_TYPE, typename COMPLETION_TOKEN>
+    auto Write(std::shared_ptr<const cli::WriteTarget> target,
+               POINT_TYPE                              point,
+               COMPLETION_TOKEN&&                      token);
+
+    struct SeriesCacheStats SeriesCacheStats() const;
+
+    struct WriteQueueStats WriteQueueStats() const;
+
+    struct BatchStats BatchStats() const;
+
 private:
     std::shared_ptr<http::IHttpClient>
     ConstructHttpClient(const ClientConfig& config);
 
+    std::unique_ptr<enc::SeriesCache>
+    ConstructSeriesCache(const ClientConfig& config);
+
+    std::unique_ptr<WriteLimiter>
+    ConstructWriteLimiter(const ClientConfig& config);
+
+    // Spills to the subdirectory of the configured directory if not empty.
+    std::shared_ptr<spill::SpillQueue>
+    ConstructSpillQueue(const ClientConfig&               config,
+                        std::shared_ptr<lb::LoadBalancer> lb,
+                        std::string_view                  subdirectory = {});
+
+    void ConstructReplication(const ClientConfig& config);
+
+    std::shared_ptr<batch::BatchWriter>
+    ConstructBatchWriter(const ClientConfig& config);
+
+    // Spawns a write through the limiter if configured.
+    template<typename FUNCTION, typename HANDLER>
+    void SpawnWrite(FUNCTION&& write, HANDLER&& handler);
+
     template<typename COMPLETION_SIGNATURE,
              typename COMPLETION_TOKEN,
              typename FUNCTION,
@@ -94,9 +151,19 @@ private:
     void Spawn(FUNCTION&& func, COMPLETION_TOKEN&& token);
 
 private:
-    Context                            ctx_;
-    std::shared_ptr<http::IHttpClient> http_;
-    std::shared_ptr<lb::LoadBalancer>  lb_;
+    Context                             ctx_;
+    enc::ParallelEncoder                encoder_;
+    std::unique_ptr<enc::SeriesCache>   cache_;
+    std::unique_ptr<WriteLimiter>       limiter_;
+    std::shared_ptr<http::IHttpClient>  http_;
+    std::shared_ptr<lb::LoadBalancer>   lb_;
+    std::shared_ptr<spill::SpillQueue>  spill_;
+    std::shared_ptr<batch::BatchWriter> batch_;
+    const bool                          routeBySeries_;
+
+    std::vector<std::shared_ptr<lb::LoadBalancer>>  replicaLbs_;
+    std::vector<std::shared_ptr<spill::SpillQueue>> replicaSpills_;
+    std::optional<cli::Replication>                 replication_;
 };
 
 } // namespace opengemini::impl
@@ -16,6 +16,7 @@
 
 #include <boost/exception/diagnostic_information.hpp>
 
+#include "opengemini/PointBatch.hpp"
 #include "opengemini/impl/cli/database/Database.hpp"
 #include "opengemini/impl/cli/database/Ping.hpp"
 #include "opengemini/impl/cli/policy/RetentionPolicy.hpp"
@@ -62,6 +63,54 @@ auto ClientImpl::Query(struct Query query, COMPLETION_TOKEN&& token)
         std::move(query));
 }
 
+template<typename COMPLETION_TOKEN>
+auto ClientImpl::Query(struct Query query,
+                       format::Columnar,
+                       COMPLETION_TOKEN&& token)
+{
+    using Signature = sig::ColumnarQuery;
+    return boost::asio::async_initiate<COMPLETION_TOKEN, Signature>(
+        [this](auto&& token, struct Query query) {
+            static_assert(util::IsInvocable_v<decltype(token), Signature>,
+                          "Completion signature of Query must be: "
+                          "void(std::exception_ptr, ColumnarQueryResult)");
+
+            Spawn<Signature>(
+                cli::RunQueryColumnar{ { *http_, *lb_ }, std::move(query) },
+                OPENGEMINI_PF(token));
+        },
+        token,
+        std::move(query));
+}
+
+template<typename COMPLETION_TOKEN>
+auto ClientImpl::QueryChunked(struct Query       query,
+                              std::size_t        chunkSize,
+                              SeriesHandler      handler,
+                              COMPLETION_TOKEN&& token)
+{
+    using Signature = sig::QueryChunked;
+    return boost::asio::async_initiate<COMPLETION_TOKEN, Signature>(
+        [this](auto&&        token,
+               struct Query  query,
+               std::size_t   chunkSize,
+               SeriesHandler handler) {
+            static_assert(util::IsInvocable_v<decltype(token), Signature>,
+                          "Completion signature of QueryChunked must be: "
+                          "void(std::exception_ptr)");
+
+            Spawn<Signature>(cli::RunQueryChunked{ { *http_, *lb_ },
+                                                   std::move(query),
+                                                   chunkSize,
+                                                   std::move(handler) },
+                             OPENGEMINI_PF(token));
+        },
+        token,
+        std::move(query),
+        chunkSize,
+        std::move(handler));
+}
+
 template<typename COMPLETION_TOKEN>
 auto ClientImpl::CreateDatabase(std::string_view        database,
                                 std::optional<RpConfig> rpConfig,
@@ -202,30 +251,92 @@ auto ClientImpl::Write(std::string_view   database,
                        POINT_TYPE         point,
                        std::string_view   retentionPolicy,
                        COMPLETION_TOKEN&& token)
+{
+    return Write<POINT_TYPE>(
+        std::make_shared<const cli::WriteTarget>(std::string(database),
+                                                 std::string(retentionPolicy)),
+        std::move(point),
+        std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename POINT_TYPE, typename COMPLETION_TOKEN>
+auto ClientImpl::Write(std::shared_ptr<const cli::WriteTarget> target,
+                       POINT_TYPE                              point,
+                       COMPLETION_TOKEN&&                      token)
 {
     using Signature = sig::Write;
     return boost::asio::async_initiate<COMPLETION_TOKEN, Signature>(
-        [this](auto&&      token,
-               std::string database,
-               std::string retentionPolicy,
-               POINT_TYPE  point) {
+        [this](auto&&                                  token,
+               std::shared_ptr<const cli::WriteTarget> target,
+               POINT_TYPE                              point) {
             static_assert(util::IsInvocable_v<decltype(token), Signature>,
                           "Completion signature of Write must be: "
                           "void(std::exception_ptr)");
 
-            Spawn<Signature>(
-                cli::RunWrite<POINT_TYPE>{ { *http_, *lb_ },
-                                           std::move(database),
-                                           std::move(retentionPolicy),
-                                           std::move(point) },
-                OPENGEMINI_PF(token));
+            // Only owned points are aggregated, borrowed points, a
+            // PointBatch, records described by Schema or raw line protocol
+            // are sent immediately.
+            if constexpr (std::is_same_v<POINT_TYPE, Point> ||
+                          std::is_same_v<POINT_TYPE, std::vector<Point>>) {
+                if (batch_) {
+                    batch_->Append(
+                        std::move(target),
+                        std::move(point),
+                        [_token =
+                             std::make_shared<std::decay_t<decltype(token)>>(
+                                 OPENGEMINI_PF(token))](std::exception_ptr ex) {
+                            (*_token)(util::ConvertException(ex));
+                        });
+                    return;
+                }
+            }
+
+            SpawnWrite(cli::RunWrite<POINT_TYPE>{ { *http_, *lb_ },
+                                                  std::move(target),
+                                                  std::move(point),
+                                                  &encoder_,
+                                                  cache_.get(),
+                                                  spill_.get(),
+                                                  routeBySeries_,
+                                                  replication_
+                                                      ? &replication_.value()
+                                                      : nullptr },
+                       OPENGEMINI_PF(token));
         },
         token,
-        std::string(database),
-        std::string(retentionPolicy),
+        std::move(target),
         std::move(point));
 }
 
+template<typename FUNCTION, typename HANDLER>
+void ClientImpl::SpawnWrite(FUNCTION&& write, HANDLER&& handler)
+{
+    if (!limiter_) {
+        Spawn<sig::Write>(std::forward<FUNCTION>(write),
+                          std::forward<HANDLER>(handler));
+        return;
+    }
+
+    auto size = cli::ApproximateSize(write.point_);
+    limiter_->Submit(
+        size,
+        [this,
+         size,
+         _write   = std::forward<FUNCTION>(write),
+         _handler = std::make_shared<std::decay_t<HANDLER>>(
+             std::forward<HANDLER>(handler))](std::exception_ptr ex) mutable {
+            if (ex) {
+                (*_handler)(ex);
+                return;
+            }
+            Spawn<sig::Write>(std::move(_write),
+                              [this, size, _handler](std::exception_ptr ex) {
+                                  limiter_->Complete(size);
+                                  (*_handler)(ex);
+                              });
+        });
+}
+
 template<typename COMPLETION_SIGNATURE,
          typename COMPLETION_TOKEN,
          typename FUNCTION,
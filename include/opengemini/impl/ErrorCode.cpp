@@ -117,6 +117,10 @@ std::string RuntimeCategory::message(int value) const
 {
     switch (static_cast<RuntimeErrors>(value)) {
     case RuntimeErrors::Unexpected: return "Unexpected error happened";
+    case RuntimeErrors::WriteQueueFull:
+        return "Too many writes are in flight";
+    case RuntimeErrors::WriteDropped: return "Write dropped before it was sent";
+    case RuntimeErrors::SpillFailed: return "Spill write to disk failed";
     }
     return "Unknown";
 }
@@ -0,0 +1,69 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/Writer.hpp"
+
+#include "opengemini/impl/ClientImpl.hpp"
+#include "opengemini/impl/cli/write/Write.hpp"
+#include "opengemini/impl/util/TypeTraits.hpp"
+
+namespace opengemini {
+
+inline Writer::Writer(impl::ClientImpl&                             impl,
+                      std::shared_ptr<const impl::cli::WriteTarget> target) :
+    impl_(&impl),
+    target_(std::move(target))
+{ }
+
+inline std::string_view Writer::Database() const noexcept
+{
+    return target_->database;
+}
+
+inline std::string_view Writer::RetentionPolicy() const noexcept
+{
+    return target_->retentionPolicy;
+}
+
+template<typename COMPLETION_TOKEN>
+auto Writer::Write(Point point, COMPLETION_TOKEN&& token) const
+{
+    return impl_->Write<Point>(target_,
+                               std::move(point),
+                               std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Writer::Write(std::vector<Point> points, COMPLETION_TOKEN&& token) const
+{
+    return impl_->Write<std::vector<Point>>(
+        target_,
+        std::move(points),
+        std::forward<COMPLETION_TOKEN>(token));
+}
+
+template<typename COMPLETION_TOKEN>
+auto Writer::Write(PointSpan points, COMPLETION_TOKEN&& token) const
+{
+    static_assert(util::IsWaitingToken_v<COMPLETION_TOKEN>,
+                  "Borrowed points can only be written with token::sync or "
+                  "token::coro");
+
+    return impl_->Write<PointSpan>(target_,
+                                   points,
+                                   std::forward<COMPLETION_TOKEN>(token));
+}
+
+} // namespace opengemini
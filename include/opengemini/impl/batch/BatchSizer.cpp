@@ -0,0 +1,119 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/batch/BatchSizer.hpp"
+
+#include <algorithm>
+
+#include "opengemini/Exception.hpp"
+
+namespace opengemini::impl::batch {
+
+namespace {
+
+inline std::size_t InitialSize(const BatchConfig& config)
+{
+    if (!config.adaptive.has_value()) { return config.batchSize; }
+
+    auto& adaptive = config.adaptive.value();
+    if (adaptive.minBatchSize == 0 ||
+        adaptive.minBatchSize > adaptive.maxBatchSize) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Adaptive batch size bounds must satisfy "
+                        "0 < minBatchSize <= maxBatchSize");
+    }
+    if (adaptive.targetLatency.count() <= 0) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Target latency must be greater than zero");
+    }
+    return std::clamp(
+        config.batchSize, adaptive.minBatchSize, adaptive.maxBatchSize);
+}
+
+// Takes about 16 successful batches to grow from the lower bound to the upper.
+inline std::size_t IncreaseStep(const BatchConfig& config)
+{
+    if (!config.adaptive.has_value()) { return 0; }
+
+    auto& adaptive = config.adaptive.value();
+    if (adaptive.maxBatchSize < adaptive.minBatchSize) { return 1; }
+    return std::max<std::size_t>(
+        (adaptive.maxBatchSize - adaptive.minBatchSize) / 16, 1);
+}
+
+} // namespace
+
+OPENGEMINI_INLINE_SPECIFIER
+BatchSizer::BatchSizer(const BatchConfig& config) :
+    config_(config),
+    step_(IncreaseStep(config)),
+    size_(InitialSize(config))
+{ }
+
+OPENGEMINI_INLINE_SPECIFIER
+std::size_t BatchSizer::BatchSize() const noexcept
+{
+    return size_;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::chrono::milliseconds BatchSizer::BatchInterval() const noexcept
+{
+    if (size_ >= config_.batchSize) { return config_.batchInterval; }
+
+    // Points wait no longer than the time it takes to fill a batch of the
+    // configured size.
+    auto ratio = static_cast<double>(size_) / config_.batchSize;
+    return std::max(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        config_.batchInterval * ratio),
+                    std::chrono::milliseconds(1));
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchSizer::OnWritten(std::size_t              points,
+                           std::chrono::nanoseconds latency,
+                           bool                     failed)
+{
+    ++flushes_;
+    if (failed) { ++failures_; }
+    latency_ = flushes_ == 1 ? latency : latency_ + (latency - latency_) / 8;
+
+    if (!config_.adaptive.has_value()) { return; }
+
+    auto& adaptive = config_.adaptive.value();
+    if (failed || latency > adaptive.targetLatency) {
+        // A batch larger than the current size was taken before the last
+        // decrease, which has already reacted to the same condition.
+        if (points <= size_) {
+            size_ = std::max(size_ / 2, adaptive.minBatchSize);
+        }
+    }
+    else if (points >= size_) {
+        // Grows only if batches are filled up rather than flushed by timer.
+        size_ = std::min(size_ + step_, adaptive.maxBatchSize);
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+BatchStats BatchSizer::Stats() const
+{
+    return { size_,
+             BatchInterval(),
+             std::chrono::duration_cast<std::chrono::milliseconds>(latency_),
+             flushes_,
+             failures_ };
+}
+
+} // namespace opengemini::impl::batch
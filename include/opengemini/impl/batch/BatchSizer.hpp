@@ -0,0 +1,61 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_BATCH_BATCHSIZER_HPP
+#define OPENGEMINI_IMPL_BATCH_BATCHSIZER_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#include "opengemini/BatchStats.hpp"
+#include "opengemini/ClientConfig.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::batch {
+
+// Decides the size and interval of batches from the latency and result of
+// the batches written before, with additive increase and multiplicative
+// decrease. Keeps the configured size and interval if not adaptive. Not safe
+// to be shared between threads without synchronization.
+class BatchSizer {
+public:
+    explicit BatchSizer(const BatchConfig& config);
+
+    std::size_t               BatchSize() const noexcept;
+    std::chrono::milliseconds BatchInterval() const noexcept;
+
+    // Called once a batch of points has been written or failed.
+    void OnWritten(std::size_t              points,
+                   std::chrono::nanoseconds latency,
+                   bool                     failed);
+
+    BatchStats Stats() const;
+
+private:
+    const BatchConfig        config_;
+    const std::size_t        step_;
+    std::size_t              size_;
+    std::chrono::nanoseconds latency_{ 0 };
+    std::uint64_t            flushes_{ 0 };
+    std::uint64_t            failures_{ 0 };
+};
+
+} // namespace opengemini::impl::batch
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/batch/BatchSizer.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_BATCH_BATCHSIZER_HPP
@@ -0,0 +1,356 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "opengemini/impl/batch/BatchWriter.hpp"
+
+#include <tuple>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/batch/Coalesce.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::batch {
+
+namespace {
+
+inline void CheckWrite(std::string_view database, const Point& point)
+{
+    if (database.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Database name cannot be empty");
+    }
+    if (point.measurement.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "The filed <measurement> in Point must not be empty");
+    }
+    if (point.fields.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "The filed <fields> in Point must not be empty");
+    }
+}
+
+// Spreads the threads over the slots of batches in the order they first write.
+inline std::size_t SlotOfThisThread()
+{
+    static std::atomic<std::size_t> next{ 0 };
+    thread_local const std::size_t  slot{
+        next.fetch_add(1, std::memory_order_relaxed) % BatchWriter::SLOTS
+    };
+    return slot;
+}
+
+} // namespace
+
+OPENGEMINI_INLINE_SPECIFIER
+BatchWriter::BatchWriter(PrivateConstructor,
+                         boost::asio::io_context& ctx,
+                         const BatchConfig&       config,
+                         Flusher                  flusher) :
+    TaskSlot(ctx),
+    config_(config),
+    flusher_(std::move(flusher)),
+    sizer_(config),
+    batchSize_(sizer_.BatchSize())
+{
+    if (config_.batchSize == 0 || config_.batchInterval.count() <= 0) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Batch size and interval must be greater than zero");
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Append(Target target, Point point, Handler handler)
+{
+    try {
+        CheckWrite(target->database, point);
+    }
+    catch (...) {
+        Complete(std::move(handler), std::current_exception());
+        return;
+    }
+
+    Accumulate(std::move(target),
+               std::move(handler),
+               [&point](std::vector<Point>& points) {
+                   points.push_back(std::move(point));
+               });
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Append(Target             target,
+                         std::vector<Point> points,
+                         Handler            handler)
+{
+    try {
+        for (auto& point : points) { CheckWrite(target->database, point); }
+    }
+    catch (...) {
+        Complete(std::move(handler), std::current_exception());
+        return;
+    }
+
+    if (points.empty()) {
+        Complete(std::move(handler), nullptr);
+        return;
+    }
+
+    Accumulate(std::move(target),
+               std::move(handler),
+               [&points](std::vector<Point>& batch) {
+                   if (batch.empty()) {
+                       batch = std::move(points);
+                       return;
+                   }
+                   batch.insert(batch.end(),
+                                std::make_move_iterator(points.begin()),
+                                std::make_move_iterator(points.end()));
+               });
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Stop()
+{
+    stopped_ = true;
+
+    std::vector<std::pair<const Key*, Batch*>> batches;
+    {
+        std::shared_lock lock(batchesMutex_);
+        for (auto& [key, batch] : batches_) {
+            batches.emplace_back(&key, &batch);
+        }
+    }
+
+    for (auto& [key, batch] : batches) {
+        if (auto pending = Take(*batch); !pending.handlers.empty()) {
+            Flush(*key, std::move(pending));
+        }
+    }
+
+    Drain();
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+BatchStats BatchWriter::Stats()
+{
+    std::lock_guard lock(sizerMutex_);
+    return sizer_.Stats();
+}
+
+template<typename FUNCTION>
+void BatchWriter::Accumulate(Target     target,
+                             Handler    handler,
+                             FUNCTION&& appendPoints)
+{
+    auto [key, batch] = BatchOf(std::move(target));
+
+    std::ptrdiff_t appended{ 0 };
+    {
+        auto&           slot = batch.slots[SlotOfThisThread()];
+        std::lock_guard lock(slot.mutex);
+        auto            before = slot.points.size();
+        appendPoints(slot.points);
+        slot.handlers.push_back(std::move(handler));
+        appended = static_cast<std::ptrdiff_t>(slot.points.size() - before);
+    }
+
+    // Only the write which makes the batch reach the limit flushes it.
+    auto limit = static_cast<std::ptrdiff_t>(batchSize_.load());
+    auto size  = batch.size.fetch_add(appended) + appended;
+    auto full  = size >= limit && size - appended < limit;
+    if (stopped_ || full || (!batch.armed && !ArmTimer(key, batch))) {
+        if (auto pending = Take(batch); !pending.handlers.empty()) {
+            Flush(key, std::move(pending));
+        }
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::pair<const BatchWriter::Key&, BatchWriter::Batch&>
+BatchWriter::BatchOf(Key key)
+{
+    {
+        std::shared_lock lock(batchesMutex_);
+        if (auto it = batches_.find(key); it != batches_.end()) {
+            return { it->first, it->second };
+        }
+    }
+
+    std::lock_guard lock(batchesMutex_);
+    auto [it, _] = batches_.try_emplace(std::move(key), ctx_);
+    return { it->first, it->second };
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+BatchWriter::Pending BatchWriter::Take(Batch& batch)
+{
+    // Disarmed before taking, a point appended after this will arm again.
+    {
+        std::lock_guard lock(batch.timerMutex);
+        batch.armed = false;
+        ++batch.generation;
+        batch.timer.cancel();
+    }
+
+    Pending pending;
+    for (auto& slot : batch.slots) {
+        std::lock_guard lock(slot.mutex);
+        if (slot.handlers.empty()) { continue; }
+        if (pending.handlers.empty()) {
+            pending.points   = std::move(slot.points);
+            pending.handlers = std::move(slot.handlers);
+        }
+        else {
+            pending.points.insert(pending.points.end(),
+                                  std::make_move_iterator(slot.points.begin()),
+                                  std::make_move_iterator(slot.points.end()));
+            pending.handlers.insert(
+                pending.handlers.end(),
+                std::make_move_iterator(slot.handlers.begin()),
+                std::make_move_iterator(slot.handlers.end()));
+        }
+        slot.points.clear();
+        slot.handlers.clear();
+    }
+    batch.size -= static_cast<std::ptrdiff_t>(pending.points.size());
+    return pending;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+bool BatchWriter::ArmTimer(const Key& key, Batch& batch)
+{
+    std::chrono::milliseconds interval;
+    {
+        std::lock_guard lock(sizerMutex_);
+        interval = sizer_.BatchInterval();
+    }
+
+    std::lock_guard lock(batch.timerMutex);
+    if (stopped_) { return false; }
+    if (batch.armed) { return true; }
+
+    batch.armed = true;
+    batch.timer.expires_after(interval);
+    batch.timer.async_wait(
+        [weak = weak_from_this(), &key, &batch, generation = batch.generation](
+            boost::system::error_code error) {
+            if (error) { return; }
+            if (auto self = weak.lock()) {
+                self->OnTimer(key, batch, generation);
+            }
+        });
+    return true;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::OnTimer(const Key&  key,
+                          Batch&      batch,
+                          std::size_t generation)
+{
+    {
+        std::lock_guard lock(batch.timerMutex);
+        if (stopped_ || batch.generation != generation) { return; }
+    }
+
+    if (auto pending = Take(batch); !pending.handlers.empty()) {
+        Flush(key, std::move(pending));
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Flush(const Key& key, Pending pending)
+{
+    auto points = pending.points.size();
+    if (config_.coalescePoints) {
+        CoalescePoints(pending.points, config_.sortByTime);
+    }
+
+    auto flight      = std::make_shared<Flight>();
+    flight->handlers = std::move(pending.handlers);
+    {
+        std::lock_guard lock(flightsMutex_);
+        flights_.insert(flight);
+    }
+
+    flusher_(key,
+             std::move(pending.points),
+             [weak = weak_from_this(),
+              flight,
+              points,
+              start = std::chrono::steady_clock::now()](std::exception_ptr ex) {
+                 if (flight->completed.exchange(true)) { return; }
+
+                 auto self = weak.lock();
+                 if (self) {
+                     std::lock_guard lock(self->sizerMutex_);
+                     self->sizer_.OnWritten(
+                         points,
+                         std::chrono::steady_clock::now() - start,
+                         ex != nullptr);
+                     self->batchSize_ = self->sizer_.BatchSize();
+                 }
+                 for (auto& handler : flight->handlers) { handler(ex); }
+                 if (self) { self->Land(flight); }
+             });
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Land(const std::shared_ptr<Flight>& flight)
+{
+    std::lock_guard lock(flightsMutex_);
+    flights_.erase(flight);
+    if (flights_.empty()) { flightsLanded_.notify_all(); }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Drain()
+{
+    std::unique_lock lock(flightsMutex_);
+    // The flushes run on the threads of the context, waiting on one of them
+    // would only run out the timeout.
+    if (!ctx_.get_executor().running_in_this_thread()) {
+        flightsLanded_.wait_for(lock, config_.stopTimeout, [this] {
+            return flights_.empty();
+        });
+    }
+    auto abandoned = std::move(flights_);
+    flights_.clear();
+    lock.unlock();
+
+    if (abandoned.empty()) { return; }
+    auto error = std::make_exception_ptr(
+        Exception(errc::RuntimeErrors::WriteDropped,
+                  "Client destroyed before the batch was written"));
+    for (auto& flight : abandoned) {
+        if (flight->completed.exchange(true)) { continue; }
+        for (auto& handler : flight->handlers) { handler(error); }
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+bool BatchWriter::KeyLess::operator()(const Key& lhs, const Key& rhs) const
+{
+    return std::tie(lhs->database, lhs->retentionPolicy) <
+           std::tie(rhs->database, rhs->retentionPolicy);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void BatchWriter::Complete(Handler handler, std::exception_ptr error)
+{
+    boost::asio::post(ctx_,
+                      [handler = std::move(handler), error = std::move(error)] {
+                          handler(error);
+                      });
+}
+
+} // namespace opengemini::impl::batch
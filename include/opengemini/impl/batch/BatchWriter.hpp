@@ -0,0 +1,174 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_BATCH_BATCHWRITER_HPP
+#define OPENGEMINI_IMPL_BATCH_BATCHWRITER_HPP
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "opengemini/BatchStats.hpp"
+#include "opengemini/ClientConfig.hpp"
+#include "opengemini/Point.hpp"
+#include "opengemini/impl/batch/BatchSizer.hpp"
+#include "opengemini/impl/cli/write/WriteTarget.hpp"
+#include "opengemini/impl/comm/TaskSlot.hpp"
+
+namespace opengemini::impl::batch {
+
+// Gathers the points written to the same database and retention policy into
+// batches, which are flushed to the target of the first write gathered. Every producer thread appends to one of SLOTS slots picked once per
+// thread, the slots are merged only when a batch is flushed.
+class BatchWriter :
+    public TaskSlot,
+    public std::enable_shared_from_this<BatchWriter> {
+public:
+    static constexpr std::size_t SLOTS{ 64 };
+
+private:
+    struct PrivateConstructor {
+        constexpr PrivateConstructor() = default;
+    };
+
+public:
+    using Target  = std::shared_ptr<const cli::WriteTarget>;
+    using Handler = std::function<void(std::exception_ptr)>;
+    using Flusher = std::function<
+        void(Target target, std::vector<Point> points, Handler handler)>;
+
+public:
+    template<typename... ARGS>
+    static std::shared_ptr<BatchWriter> Construct(ARGS&&... args)
+    {
+        return std::make_shared<BatchWriter>(PrivateConstructor{},
+                                             std::forward<ARGS>(args)...);
+    }
+
+    BatchWriter(PrivateConstructor,
+                boost::asio::io_context& ctx,
+                const BatchConfig&       config,
+                Flusher                  flusher);
+
+    ~BatchWriter() = default;
+
+    void Append(Target target, Point point, Handler handler);
+
+    void Append(Target target, std::vector<Point> points, Handler handler);
+
+    // Flushes the pending batches and waits for all flushes to complete
+    // within BatchConfig::stopTimeout, the writes still in flight after that
+    // fail with errc::RuntimeErrors::WriteDropped.
+    void Stop();
+
+    BatchStats Stats();
+
+private:
+    // Batches are keyed by the names of their targets, so that the writes to
+    // the same ones share a batch even if their targets are built apart.
+    using Key = Target;
+
+    struct KeyLess {
+        bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+
+    // The points appended by the threads sharing a slot, so that producer
+    // threads rarely contend with each other. Padded to avoid false sharing.
+    struct alignas(64) Slot {
+        std::mutex           mutex;
+        std::vector<Point>   points;
+        std::vector<Handler> handlers;
+    };
+
+    struct Batch {
+        std::array<Slot, SLOTS> slots;
+        // The number of points in slots, which may lag behind or run ahead of
+        // the slots while points are being appended or taken concurrently.
+        std::atomic<std::ptrdiff_t> size{ 0 };
+        std::atomic<bool>           armed{ false };
+
+        std::mutex                timerMutex;
+        boost::asio::steady_timer timer;
+        std::size_t               generation{ 0 };
+
+        explicit Batch(boost::asio::io_context& ctx) : timer(ctx) { }
+    };
+
+    struct Pending {
+        std::vector<Point>   points;
+        std::vector<Handler> handlers;
+    };
+
+    // The handlers of a flushed batch, completed either by the flush or by
+    // Stop() giving up on it, whichever comes first.
+    struct Flight {
+        std::vector<Handler> handlers;
+        std::atomic<bool>    completed{ false };
+    };
+
+private:
+    template<typename FUNCTION>
+    void Accumulate(Target target, Handler handler, FUNCTION&& appendPoints);
+
+    std::pair<const Key&, Batch&> BatchOf(Key key);
+
+    // Merges the points of all slots, any thread may take a batch at any time.
+    Pending Take(Batch& batch);
+
+    // Returns false if stopped, the batch should be flushed right away.
+    bool ArmTimer(const Key& key, Batch& batch);
+    void OnTimer(const Key& key, Batch& batch, std::size_t generation);
+
+    void Flush(const Key& key, Pending pending);
+
+    void Land(const std::shared_ptr<Flight>& flight);
+
+    // Waits for the flights within the timeout and fails the rest.
+    void Drain();
+
+    void Complete(Handler handler, std::exception_ptr error);
+
+private:
+    const BatchConfig config_;
+    const Flusher     flusher_;
+
+    std::map<Key, Batch, KeyLess> batches_;
+    std::shared_mutex             batchesMutex_;
+
+    BatchSizer               sizer_;
+    std::mutex               sizerMutex_;
+    std::atomic<std::size_t> batchSize_;
+
+    std::atomic<bool> stopped_{ false };
+
+    std::unordered_set<std::shared_ptr<Flight>> flights_;
+    std::mutex                                  flightsMutex_;
+    std::condition_variable                     flightsLanded_;
+};
+
+} // namespace opengemini::impl::batch
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/batch/BatchWriter.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_BATCH_BATCHWRITER_HPP
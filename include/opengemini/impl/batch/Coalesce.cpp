@@ -0,0 +1,117 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/batch/Coalesce.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+
+namespace opengemini::impl::batch {
+
+namespace {
+
+struct SeriesHash {
+    std::size_t operator()(const Point* point) const
+    {
+        std::size_t hash{ 0 };
+        boost::hash_combine(hash, boost::hash_value(point->measurement));
+        for (auto& [key, value] : point->tags) {
+            boost::hash_combine(hash, boost::hash_value(key));
+            boost::hash_combine(hash, boost::hash_value(value));
+        }
+        return hash;
+    }
+};
+
+struct SeriesEqual {
+    bool operator()(const Point* lhs, const Point* rhs) const
+    {
+        return lhs->measurement == rhs->measurement && lhs->tags == rhs->tags;
+    }
+};
+
+// Indexes of the points of every series, in the order the series first
+// appear.
+std::vector<std::vector<std::size_t>>
+GroupBySeries(const std::vector<Point>& points)
+{
+    std::vector<std::vector<std::size_t>> groups;
+    std::unordered_map<const Point*, std::size_t, SeriesHash, SeriesEqual>
+        groupOf;
+    for (std::size_t idx = 0; idx < points.size(); ++idx) {
+        auto [it, inserted] = groupOf.try_emplace(&points[idx], groups.size());
+        if (inserted) { groups.emplace_back(); }
+        groups[it->second].push_back(idx);
+    }
+    return groups;
+}
+
+} // namespace
+
+OPENGEMINI_INLINE_SPECIFIER
+void CoalescePoints(std::vector<Point>& points, bool sortByTime)
+{
+    if (points.size() < 2) { return; }
+
+    auto groups = GroupBySeries(points);
+    // Every point is a series of its own, nothing to merge or sort.
+    if (groups.size() == points.size()) { return; }
+
+    std::vector<Point> result;
+    result.reserve(points.size());
+    // Position in result of the last point of the series at a time.
+    std::unordered_map<Point::Time::rep, std::size_t> lineAt;
+    for (auto& group : groups) {
+        if (sortByTime) {
+            std::stable_sort(group.begin(),
+                             group.end(),
+                             [&points](std::size_t lhs, std::size_t rhs) {
+                                 return points[lhs].time < points[rhs].time;
+                             });
+        }
+
+        lineAt.clear();
+        for (auto idx : group) {
+            auto& point = points[idx];
+            // Lines without a timestamp are each stamped by the server on
+            // arrival, so they are not the same sample even if both are 0.
+            if (enc::LineProtocolEncoder::TimestampOf(point.time,
+                                                      point.precision) == 0) {
+                result.push_back(std::move(point));
+                continue;
+            }
+
+            auto [it, inserted] = lineAt.try_emplace(
+                point.time.time_since_epoch().count(),
+                result.size());
+            if (!inserted && result[it->second].precision == point.precision) {
+                auto& fields = result[it->second].fields;
+                for (auto& [key, value] : point.fields) {
+                    fields.insert_or_assign(std::move(key), std::move(value));
+                }
+                continue;
+            }
+            it->second = result.size();
+            result.push_back(std::move(point));
+        }
+    }
+    points = std::move(result);
+}
+
+} // namespace opengemini::impl::batch
@@ -0,0 +1,39 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_BATCH_COALESCE_HPP
+#define OPENGEMINI_IMPL_BATCH_COALESCE_HPP
+
+#include <vector>
+
+#include "opengemini/Point.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::batch {
+
+// Groups the points by series (measurement and tags), keeping the series in
+// the order they first appear, and merges the points of a series which have
+// the same time and precision into one holding the union of their fields, the
+// field of the later point wins. The points of every series are also sorted
+// by time if sortByTime, points of equal time keep their order.
+void CoalescePoints(std::vector<Point>& points, bool sortByTime);
+
+} // namespace opengemini::impl::batch
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/batch/Coalesce.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_BATCH_COALESCE_HPP
@@ -14,9 +14,8 @@
 
 #include "opengemini/impl/cli/query/Query.hpp"
 
-#include <boost/url.hpp>
-
 #include "opengemini/Exception.hpp"
+#include "opengemini/impl/cli/query/ResultDecoder.hpp"
 #include "opengemini/impl/comm/UrlTargets.hpp"
 
 namespace opengemini::impl::cli {
@@ -31,7 +30,21 @@ inline void CheckQuery(const struct Query& query)
     }
 }
 
-inline auto ParseQueryRsp(const http::Response& rsp)
+inline std::string BuildGetTarget(const struct Query& query)
+{
+    std::string target{ url::QUERY };
+    target.append("?db=");
+    util::PercentEncodeTo(query.database, target);
+    target.append("&q=");
+    util::PercentEncodeTo(query.command, target);
+    target.append("&rp=");
+    util::PercentEncodeTo(query.retentionPolicy, target);
+    target.append("&epoch=");
+    target.append(ToString(query.precision));
+    return target;
+}
+
+inline void CheckStatus(const http::Response& rsp)
 {
     if (rsp.result() != http::Status::ok) {
         throw Exception(errc::ServerErrors::UnexpectedStatusCode,
@@ -39,8 +52,12 @@ inline auto ParseQueryRsp(const http::Response& rsp)
                                     rsp.result_int(),
                                     rsp.body()));
     }
+}
 
-    return nlohmann::json::parse(rsp.body()).get<QueryResult>();
+inline auto ParseQueryRsp(const http::Response& rsp)
+{
+    CheckStatus(rsp);
+    return DecodeQueryResult(rsp.body());
 }
 
 } // namespace
@@ -50,15 +67,20 @@ QueryResult RunQueryGet::operator()(boost::asio::yield_context yield) const
 {
     CheckQuery(query_);
 
-    boost::url target(url::QUERY);
-    target.set_query(fmt::format("db={}&q={}&rp={}&epoch={}",
-                                 query_.database,
-                                 query_.command,
-                                 query_.retentionPolicy,
-                                 ToString(query_.precision)));
-
     return ParseQueryRsp(
-        http_.Get(lb_.PickAvailableServer(), target.buffer(), yield));
+        http_.Get(lb_.PickAvailableServer(), BuildGetTarget(query_), yield));
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ColumnarQueryResult
+RunQueryColumnar::operator()(boost::asio::yield_context yield) const
+{
+    CheckQuery(query_);
+
+    auto rsp =
+        http_.Get(lb_.PickAvailableServer(), BuildGetTarget(query_), yield);
+    CheckStatus(rsp);
+    return DecodeColumnarResult(rsp.body());
 }
 
 OPENGEMINI_INLINE_SPECIFIER
@@ -66,12 +88,39 @@ QueryResult RunQueryPost::operator()(boost::asio::yield_context yield) const
 {
     CheckQuery(query_);
 
-    boost::url target(url::QUERY);
-    target.set_query(
-        fmt::format("db={}&q={}", query_.database, query_.command));
+    std::string target{ url::QUERY };
+    target.append("?db=");
+    util::PercentEncodeTo(query_.database, target);
+    target.append("&q=");
+    util::PercentEncodeTo(query_.command, target);
 
-    return ParseQueryRsp(
-        http_.Post(lb_.PickAvailableServer(), target.buffer(), {}, yield));
+    return ParseQueryRsp(http_.Post(
+        lb_.PickAvailableServer(), std::move(target), std::string{}, yield));
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void RunQueryChunked::operator()(boost::asio::yield_context yield) const
+{
+    CheckQuery(query_);
+    if (!handler_) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Series handler must not be empty");
+    }
+
+    auto target = BuildGetTarget(query_);
+    target.append("&chunked=true");
+    // The server picks its default chunk size if none is given.
+    if (chunkSize_ != 0) {
+        target.append("&chunk_size=");
+        target.append(std::to_string(chunkSize_));
+    }
+
+    ChunkDecoder decoder(handler_);
+    auto consume = [&decoder](std::string& body) { decoder.Consume(body); };
+    auto rsp     = http_.Get(
+        lb_.PickAvailableServer(), std::move(target), consume, yield);
+    CheckStatus(rsp);
+    decoder.Finish(rsp.body());
 }
 
 } // namespace opengemini::impl::cli
@@ -15,6 +15,7 @@
 #ifndef OPENGEMINI_IMPL_CLI_QUERY_QUERY_HPP
 #define OPENGEMINI_IMPL_CLI_QUERY_QUERY_HPP
 
+#include "opengemini/ColumnarResult.hpp"
 #include "opengemini/Query.hpp"
 #include "opengemini/impl/cli/Functor.hpp"
 #include "opengemini/impl/util/Preprocessor.hpp"
@@ -27,12 +28,29 @@ struct RunQueryGet : public Functor {
     struct Query query_;
 };
 
+struct RunQueryColumnar : public Functor {
+    ColumnarQueryResult operator()(boost::asio::yield_context yield) const;
+
+    struct Query query_;
+};
+
 struct RunQueryPost : public Functor {
     QueryResult operator()(boost::asio::yield_context yield) const;
 
     struct Query query_;
 };
 
+// Hands the series to the handler chunk by chunk while the response is being
+// read, the handler runs on the reading coroutine so the socket is not read
+// again until it returns.
+struct RunQueryChunked : public Functor {
+    void operator()(boost::asio::yield_context yield) const;
+
+    struct Query  query_;
+    std::size_t   chunkSize_;
+    SeriesHandler handler_;
+};
+
 } // namespace opengemini::impl::cli
 
 #ifndef OPENGEMINI_SEPARATE_COMPILATION
@@ -0,0 +1,564 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/cli/query/ResultDecoder.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "opengemini/Exception.hpp"
+
+namespace opengemini::impl::cli {
+
+namespace {
+
+[[noreturn]] inline void ThrowMismatch(std::string_view key)
+{
+    throw Exception(errc::RuntimeErrors::Unexpected,
+                    fmt::format("Malformed query response, unexpected value at "
+                                "key \"{}\"",
+                                key));
+}
+
+// Stores the rows of a series as they are.
+class RowAppender {
+public:
+    using Result = QueryResult;
+
+    void AddColumn(Series& series, std::string name)
+    {
+        series.columns.push_back(std::move(name));
+    }
+
+    void StartRow(Series& series)
+    {
+        series.values.emplace_back().reserve(series.columns.size());
+    }
+
+    template<typename T>
+    void Append(Series& series, T&& value)
+    {
+        series.values.back().emplace_back(std::forward<T>(value));
+    }
+
+    void EndRow(Series&) { }
+
+    void EndSeries(Series&) { }
+};
+
+// Stores the rows of a series into typed columns, see ColumnarSeries.
+class ColumnAppender {
+public:
+    using Result = ColumnarQueryResult;
+
+    void AddColumn(ColumnarSeries& series, std::string name)
+    {
+        if (names_ < series.columns.size()) {
+            series.columns[names_].name = std::move(name);
+        }
+        else {
+            series.columns.push_back({ std::move(name), {}, {} });
+        }
+        ++names_;
+    }
+
+    void StartRow(ColumnarSeries&) { cell_ = 0; }
+
+    template<typename T>
+    void Append(ColumnarSeries& series, T&& value)
+    {
+        if (cell_ == series.columns.size()) {
+            // A column without name, which is null in the rows before.
+            series.columns.push_back(
+                { {}, {}, std::vector<bool>(series.rows, true) });
+        }
+        if (cell_ == dictionaries_.size()) { dictionaries_.emplace_back(); }
+        auto& column     = series.columns[cell_];
+        auto& dictionary = dictionaries_[cell_];
+        ++cell_;
+
+        using Type = std::decay_t<T>;
+        if constexpr (std::is_same_v<Type, std::monostate>) {
+            AppendNull(column, series.rows);
+        }
+        else if constexpr (std::is_same_v<Type, uint64_t>) {
+            // Integers are signed unless they do not fit.
+            if (value <= static_cast<uint64_t>(INT64_MAX)) {
+                AppendValue(column,
+                            series.rows,
+                            dictionary,
+                            static_cast<int64_t>(value));
+            }
+            else {
+                AppendValue(column, series.rows, dictionary, value);
+            }
+        }
+        else {
+            AppendValue(column, series.rows, dictionary, std::move(value));
+        }
+    }
+
+    void EndRow(ColumnarSeries& series)
+    {
+        // The missing cells at the end of a row are taken as null.
+        for (; cell_ < series.columns.size(); ++cell_) {
+            AppendNull(series.columns[cell_], series.rows);
+        }
+        ++series.rows;
+    }
+
+    void EndSeries(ColumnarSeries& series)
+    {
+        auto& columns = series.columns;
+        if (!columns.empty() && columns.front().name == "time" &&
+            columns.front().nulls.empty() &&
+            std::holds_alternative<std::vector<int64_t>>(
+                columns.front().values)) {
+            series.times = std::move(
+                std::get<std::vector<int64_t>>(columns.front().values));
+            columns.erase(columns.begin());
+        }
+        names_ = 0;
+        dictionaries_.clear();
+    }
+
+private:
+    using Dictionary = std::unordered_map<std::string, uint32_t>;
+
+    static void AppendNull(ColumnarSeries::Column& column, std::size_t rows)
+    {
+        if (column.nulls.empty()) { column.nulls.resize(rows, false); }
+        column.nulls.push_back(true);
+        std::visit(
+            [](auto& values) {
+                using Values = std::decay_t<decltype(values)>;
+                if constexpr (std::is_same_v<Values, StringColumn>) {
+                    values.codes.push_back(0);
+                }
+                else if constexpr (!std::is_same_v<Values, std::monostate>) {
+                    values.emplace_back();
+                }
+            },
+            column.values);
+    }
+
+    template<typename T>
+    static void AppendValue(ColumnarSeries::Column& column,
+                            std::size_t             rows,
+                            Dictionary&             dictionary,
+                            T                       value)
+    {
+        using Values = std::conditional_t<std::is_same_v<T, std::string>,
+                                          StringColumn,
+                                          std::vector<T>>;
+
+        if (std::holds_alternative<std::monostate>(column.values)) {
+            // All the rows before are null.
+            if constexpr (std::is_same_v<T, std::string>) {
+                column.values = StringColumn{ {}, std::vector<uint32_t>(rows) };
+            }
+            else {
+                column.values = std::vector<T>(rows);
+            }
+        }
+        else if (!std::holds_alternative<Values>(column.values)) {
+            Promote<T>(column, value);
+        }
+
+        if (!column.nulls.empty()) { column.nulls.push_back(false); }
+        std::visit(
+            [&](auto& values) {
+                using Stored = std::decay_t<decltype(values)>;
+                if constexpr (std::is_same_v<Stored, StringColumn>) {
+                    if constexpr (std::is_same_v<T, std::string>) {
+                        auto [iter, inserted] = dictionary.try_emplace(
+                            value,
+                            static_cast<uint32_t>(values.dictionary.size()));
+                        if (inserted) {
+                            values.dictionary.push_back(std::move(value));
+                        }
+                        values.codes.push_back(iter->second);
+                    }
+                }
+                else if constexpr (std::is_arithmetic_v<T> &&
+                                   !std::is_same_v<Stored, std::monostate>) {
+                    values.push_back(
+                        static_cast<typename Stored::value_type>(value));
+                }
+            },
+            column.values);
+    }
+
+    // Converts the stored numbers so that value fits in too: signed and
+    // unsigned integers stay integers while none of them is negative,
+    // otherwise the column turns into double. Other mixtures are rejected.
+    template<typename T>
+    static void Promote(ColumnarSeries::Column& column, const T& value)
+    {
+        auto& values = column.values;
+        auto  mixed  = [&column] {
+            throw Exception(
+                errc::RuntimeErrors::Unexpected,
+                fmt::format("Malformed query response, column \"{}\" holds "
+                            "values of different types",
+                            column.name));
+        };
+
+        if constexpr (std::is_same_v<T, double> || std::is_same_v<T, int64_t> ||
+                      std::is_same_v<T, uint64_t>) {
+            auto nonNegative = [](auto& numbers) {
+                return std::all_of(numbers.begin(),
+                                   numbers.end(),
+                                   [](auto number) { return number >= 0; });
+            };
+            auto convert = [&values](auto& numbers, auto target) {
+                using Target = decltype(target);
+                std::vector<Target> converted(numbers.begin(), numbers.end());
+                values = std::move(converted);
+            };
+
+            if (auto ints = std::get_if<std::vector<int64_t>>(&values)) {
+                if constexpr (std::is_same_v<T, uint64_t>) {
+                    if (nonNegative(*ints)) { return convert(*ints, T{}); }
+                }
+                return convert(*ints, double{});
+            }
+            if (auto uints = std::get_if<std::vector<uint64_t>>(&values)) {
+                if constexpr (std::is_same_v<T, int64_t>) {
+                    if (value >= 0) { return; }
+                }
+                return convert(*uints, double{});
+            }
+            if (std::holds_alternative<std::vector<double>>(values)) { return; }
+        }
+        mixed();
+    }
+
+private:
+    std::size_t             names_{ 0 };
+    std::size_t             cell_{ 0 };
+    std::vector<Dictionary> dictionaries_;
+};
+
+// Fills a result from the events of nlohmann::json::sax_parse(), the scopes
+// mirror the nesting of the value being parsed. A null where a known key
+// expects a string or a container is taken as absent. The rows of a series
+// are stored through APPENDER.
+template<typename APPENDER>
+class ResultSaxHandler {
+public:
+    using json   = nlohmann::json;
+    using Result = typename APPENDER::Result;
+
+public:
+    Result Take() { return std::move(result_); }
+
+    bool null() { return Value(std::monostate{}); }
+
+    bool boolean(bool value) { return Value(value); }
+
+    bool number_integer(json::number_integer_t value)
+    {
+        return Value(static_cast<int64_t>(value));
+    }
+
+    bool number_unsigned(json::number_unsigned_t value)
+    {
+        return Value(static_cast<uint64_t>(value));
+    }
+
+    bool number_float(json::number_float_t value, const json::string_t&)
+    {
+        return Value(static_cast<double>(value));
+    }
+
+    bool string(json::string_t& value) { return Value(std::move(value)); }
+
+    // Never produced from JSON text.
+    bool binary(json::binary_t&) { return Value(std::monostate{}); }
+
+    bool start_object(std::size_t)
+    {
+        scopes_.push_back(Enter(true));
+        return true;
+    }
+
+    bool key(json::string_t& key)
+    {
+        key_ = std::move(key);
+        return true;
+    }
+
+    bool end_object()
+    {
+        if (scopes_.back() == Scope::Series) {
+            appender_.EndSeries(CurrentSeries());
+        }
+        scopes_.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t)
+    {
+        scopes_.push_back(Enter(false));
+        return true;
+    }
+
+    bool end_array()
+    {
+        if (scopes_.back() == Scope::Row) { appender_.EndRow(CurrentSeries()); }
+        scopes_.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t,
+                     const std::string&,
+                     const nlohmann::detail::exception& ex)
+    {
+        throw Exception(errc::RuntimeErrors::Unexpected,
+                        fmt::format("Malformed query response: {}", ex.what()));
+    }
+
+private:
+    enum class Scope {
+        Response,
+        Results,
+        Result,
+        SeriesList,
+        Series,
+        Tags,
+        Columns,
+        Rows,
+        Row,
+        Skip,
+    };
+
+private:
+    template<typename T>
+    bool Value(T&& value)
+    {
+        constexpr auto isNull =
+            std::is_same_v<std::decay_t<T>, std::monostate>;
+
+        if (scopes_.empty()) { Mismatch(); }
+        switch (scopes_.back()) {
+        case Scope::Response:
+            if (key_ == "error") { AssignString(result_.error, value); }
+            else if (key_ == "results" && !isNull) {
+                Mismatch();
+            }
+            break;
+        case Scope::Result:
+            if (key_ == "error") { AssignString(CurrentResult().error, value); }
+            else if (key_ == "series" && !isNull) {
+                Mismatch();
+            }
+            break;
+        case Scope::Series:
+            if (key_ == "name") { AssignString(CurrentSeries().name, value); }
+            else if ((key_ == "tags" || key_ == "columns" ||
+                      key_ == "values") &&
+                     !isNull) {
+                Mismatch();
+            }
+            break;
+        case Scope::Tags:
+            if constexpr (std::is_same_v<std::decay_t<T>, std::string>) {
+                CurrentSeries().tags.insert_or_assign(std::move(key_),
+                                                      std::move(value));
+            }
+            else {
+                Mismatch();
+            }
+            break;
+        case Scope::Columns:
+            if constexpr (std::is_same_v<std::decay_t<T>, std::string>) {
+                appender_.AddColumn(CurrentSeries(), std::move(value));
+            }
+            else {
+                Mismatch();
+            }
+            break;
+        case Scope::Row:
+            appender_.Append(CurrentSeries(), std::forward<T>(value));
+            break;
+        case Scope::Skip: break;
+        default: Mismatch();
+        }
+        return true;
+    }
+
+    // Returns the scope of the object or array being started.
+    Scope Enter(bool object)
+    {
+        if (scopes_.empty()) {
+            Expect(object);
+            return Scope::Response;
+        }
+
+        switch (scopes_.back()) {
+        case Scope::Response:
+            if (key_ == "results") {
+                Expect(!object);
+                return Scope::Results;
+            }
+            Expect(key_ != "error");
+            return Scope::Skip;
+        case Scope::Results:
+            Expect(object);
+            result_.results.emplace_back();
+            return Scope::Result;
+        case Scope::Result:
+            if (key_ == "series") {
+                Expect(!object);
+                return Scope::SeriesList;
+            }
+            Expect(key_ != "error");
+            return Scope::Skip;
+        case Scope::SeriesList:
+            Expect(object);
+            CurrentResult().series.emplace_back();
+            return Scope::Series;
+        case Scope::Series:
+            if (key_ == "tags") {
+                Expect(object);
+                return Scope::Tags;
+            }
+            if (key_ == "columns" || key_ == "values") {
+                Expect(!object);
+                return key_ == "columns" ? Scope::Columns : Scope::Rows;
+            }
+            Expect(key_ != "name");
+            return Scope::Skip;
+        case Scope::Rows:
+            Expect(!object);
+            appender_.StartRow(CurrentSeries());
+            return Scope::Row;
+        case Scope::Row:
+            // A nested value in a row is taken as null.
+            appender_.Append(CurrentSeries(), std::monostate{});
+            return Scope::Skip;
+        case Scope::Skip: return Scope::Skip;
+        default: Mismatch();
+        }
+    }
+
+    template<typename T>
+    void AssignString(std::string& target, T& value)
+    {
+        if constexpr (std::is_same_v<std::decay_t<T>, std::string>) {
+            target = std::move(value);
+        }
+        else if constexpr (!std::is_same_v<std::decay_t<T>, std::monostate>) {
+            Mismatch();
+        }
+    }
+
+    auto& CurrentResult() { return result_.results.back(); }
+
+    auto& CurrentSeries() { return CurrentResult().series.back(); }
+
+    void Expect(bool condition) const
+    {
+        if (!condition) { Mismatch(); }
+    }
+
+    [[noreturn]] void Mismatch() const { ThrowMismatch(key_); }
+
+private:
+    Result             result_;
+    APPENDER           appender_;
+    std::vector<Scope> scopes_;
+    std::string        key_;
+};
+
+template<typename APPENDER>
+auto Decode(std::string_view body)
+{
+    ResultSaxHandler<APPENDER> handler;
+    nlohmann::json::sax_parse(body.begin(), body.end(), &handler);
+    return handler.Take();
+}
+
+} // namespace
+
+OPENGEMINI_INLINE_SPECIFIER
+QueryResult DecodeQueryResult(std::string_view body)
+{
+    return Decode<RowAppender>(body);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ColumnarQueryResult DecodeColumnarResult(std::string_view body)
+{
+    return Decode<ColumnAppender>(body);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+ChunkDecoder::ChunkDecoder(SeriesHandler handler) : handler_(std::move(handler))
+{ }
+
+OPENGEMINI_INLINE_SPECIFIER
+void ChunkDecoder::Consume(std::string& body)
+{
+    std::size_t begin{ 0 };
+    auto        end = body.find('\n', scanned_);
+    while (end != std::string::npos) {
+        Decode(std::string_view{ body }.substr(begin, end - begin));
+        begin = end + 1;
+        end   = body.find('\n', begin);
+    }
+    body.erase(0, begin);
+    // The partial line left behind has been searched already.
+    scanned_ = body.size();
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void ChunkDecoder::Finish(std::string& body)
+{
+    Consume(body);
+    Decode(body);
+    body.clear();
+    scanned_ = 0;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void ChunkDecoder::Decode(std::string_view chunk)
+{
+    if (chunk.find_first_not_of(" \t\r\n") == std::string_view::npos) {
+        return;
+    }
+
+    auto result = DecodeQueryResult(chunk);
+    if (auto error = free::HasError(result); error) {
+        throw Exception(errc::ServerErrors::ErrorResult,
+                        fmt::format("Query failed: {}", *error));
+    }
+    for (auto& seriesResult : result.results) {
+        for (auto& series : seriesResult.series) {
+            handler_(std::move(series));
+        }
+    }
+}
+
+} // namespace opengemini::impl::cli
@@ -0,0 +1,68 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_CLI_QUERY_RESULTDECODER_HPP
+#define OPENGEMINI_IMPL_CLI_QUERY_RESULTDECODER_HPP
+
+#include <string>
+#include <string_view>
+
+#include "opengemini/ColumnarResult.hpp"
+#include "opengemini/Query.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::cli {
+
+// Decodes the body of a query response straight into the result in one pass,
+// without building a JSON document first. Unknown keys are ignored, a body
+// which is not valid JSON or whose known keys hold values of unexpected types
+// is reported with errc::RuntimeErrors::Unexpected.
+QueryResult DecodeQueryResult(std::string_view body);
+
+// Decodes the body of a query response straight into typed columns, in the
+// same way as DecodeQueryResult(). A column holding both strings and numbers
+// is reported with errc::RuntimeErrors::Unexpected too.
+ColumnarQueryResult DecodeColumnarResult(std::string_view body);
+
+// Decodes the body of a chunked query response, in which every chunk is a
+// whole query response on a line of its own, as soon as each line has been
+// received. The series are handed to the handler in order, a chunk carrying
+// an error is reported with errc::ServerErrors::ErrorResult.
+class ChunkDecoder {
+public:
+    explicit ChunkDecoder(SeriesHandler handler);
+
+    // Decodes the complete lines at the front of body and erases them, so
+    // that no more than one chunk is held at a time.
+    void Consume(std::string& body);
+
+    // Decodes what is left in body once the whole response has been read.
+    void Finish(std::string& body);
+
+private:
+    void Decode(std::string_view chunk);
+
+private:
+    SeriesHandler handler_;
+    std::size_t   scanned_{ 0 };
+};
+
+} // namespace opengemini::impl::cli
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/cli/query/ResultDecoder.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_CLI_QUERY_RESULTDECODER_HPP
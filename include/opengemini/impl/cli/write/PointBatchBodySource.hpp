@@ -0,0 +1,60 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_CLI_WRITE_POINTBATCHBODYSOURCE_HPP
+#define OPENGEMINI_IMPL_CLI_WRITE_POINTBATCHBODYSOURCE_HPP
+
+#include <algorithm>
+
+#include "opengemini/PointBatch.hpp"
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+#include "opengemini/impl/http/StreamingBody.hpp"
+
+namespace opengemini::impl::cli {
+
+// Encodes the rows of a batch into line protocol block by block while the
+// request is being sent, the batch must outlive the request.
+class PointBatchBodySource : public http::BodySource {
+public:
+    static constexpr std::size_t ROWS_PER_PIECE{ 1024 };
+
+public:
+    explicit PointBatchBodySource(const PointBatch& batch) : batch_(batch)
+    {
+        encoder_.SetTimeUnit(batch.precision);
+    }
+
+    void Rewind() override { next_ = 0; }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        auto rows = batch_.times.size();
+        if (next_ < rows) {
+            auto end = std::min(next_ + ROWS_PER_PIECE, rows);
+            encoder_.EncodeTo(batch_, next_, end, chain);
+            next_ = end;
+        }
+        return next_ < rows;
+    }
+
+private:
+    const PointBatch&        batch_;
+    std::size_t              next_{ 0 };
+    enc::LineProtocolEncoder encoder_;
+};
+
+} // namespace opengemini::impl::cli
+
+#endif // !OPENGEMINI_IMPL_CLI_WRITE_POINTBATCHBODYSOURCE_HPP
@@ -0,0 +1,56 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_CLI_WRITE_POINTSBODYSOURCE_HPP
+#define OPENGEMINI_IMPL_CLI_WRITE_POINTSBODYSOURCE_HPP
+
+#include "opengemini/PointSpan.hpp"
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+#include "opengemini/impl/http/StreamingBody.hpp"
+
+namespace opengemini::impl::cli {
+
+// Encodes the points into line protocol chunk by chunk while the request is
+// being sent, the points must outlive the request.
+class PointsBodySource : public http::BodySource {
+public:
+    PointsBodySource(PointSpan         points,
+                     Precision         unit,
+                     enc::SeriesCache* cache = nullptr) :
+        points_(points),
+        encoder_(cache)
+    {
+        encoder_.SetTimeUnit(unit);
+    }
+
+    void Rewind() override { next_ = 0; }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        auto limit = chain.Size() + util::ChunkPool::CHUNK_SIZE;
+        while (next_ < points_.size() && chain.Size() < limit) {
+            encoder_.EncodeTo(points_[next_++], chain);
+        }
+        return next_ < points_.size();
+    }
+
+private:
+    PointSpan                points_;
+    std::size_t              next_{ 0 };
+    enc::LineProtocolEncoder encoder_;
+};
+
+} // namespace opengemini::impl::cli
+
+#endif // !OPENGEMINI_IMPL_CLI_WRITE_POINTSBODYSOURCE_HPP
@@ -0,0 +1,57 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_CLI_WRITE_RAWBODYSOURCE_HPP
+#define OPENGEMINI_IMPL_CLI_WRITE_RAWBODYSOURCE_HPP
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "opengemini/impl/http/StreamingBody.hpp"
+
+namespace opengemini::impl::cli {
+
+// Line protocol produced by the caller, which is sent as is. The buffers point
+// into memory kept alive by owner.
+struct RawBody {
+    std::vector<std::string_view> buffers;
+    std::shared_ptr<const void>   owner;
+
+    // Whether to scan the lines for obvious mistakes before sending them.
+    bool validate{ true };
+};
+
+// Hands the buffers of a raw body to the request without copying them, the
+// body must outlive the request.
+class RawBodySource : public http::BodySource {
+public:
+    explicit RawBodySource(const RawBody& body) : body_(body) { }
+
+    void Rewind() override { }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        for (auto buffer : body_.buffers) { chain.Borrow(buffer); }
+        return false;
+    }
+
+private:
+    const RawBody& body_;
+};
+
+} // namespace opengemini::impl::cli
+
+#endif // !OPENGEMINI_IMPL_CLI_WRITE_RAWBODYSOURCE_HPP
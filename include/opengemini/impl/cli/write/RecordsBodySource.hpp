@@ -0,0 +1,58 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_CLI_WRITE_RECORDSBODYSOURCE_HPP
+#define OPENGEMINI_IMPL_CLI_WRITE_RECORDSBODYSOURCE_HPP
+
+#include <vector>
+
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+#include "opengemini/impl/http/StreamingBody.hpp"
+
+namespace opengemini::impl::cli {
+
+// Encodes the records described by Schema<RECORD> into line protocol chunk by
+// chunk while the request is being sent, the records must outlive the
+// request.
+template<typename RECORD>
+class RecordsBodySource : public http::BodySource {
+public:
+    explicit RecordsBodySource(const std::vector<RECORD>& records) :
+        records_(records)
+    {
+        encoder_.SetTimeUnit(
+            schema::detail::PrecisionOf<Schema<RECORD>>::value);
+    }
+
+    void Rewind() override { next_ = 0; }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        auto limit = chain.Size() + util::ChunkPool::CHUNK_SIZE;
+        while (next_ < records_.size() && chain.Size() < limit) {
+            encoder_.EncodeTo(records_[next_++], chain);
+        }
+        return next_ < records_.size();
+    }
+
+private:
+    const std::vector<RECORD>& records_;
+    std::size_t                next_{ 0 };
+    enc::LineProtocolEncoder   encoder_;
+};
+
+} // namespace opengemini::impl::cli
+
+#endif // !OPENGEMINI_IMPL_CLI_WRITE_RECORDSBODYSOURCE_HPP
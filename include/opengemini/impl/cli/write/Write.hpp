@@ -15,20 +15,143 @@
 #ifndef OPENGEMINI_IMPL_CLI_WRITE_WRITE_HPP
 #define OPENGEMINI_IMPL_CLI_WRITE_WRITE_HPP
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
 #include "opengemini/impl/cli/Functor.hpp"
+#include "opengemini/impl/cli/write/WriteTarget.hpp"
+#include "opengemini/impl/enc/ParallelEncoder.hpp"
+#include "opengemini/impl/spill/SpillQueue.hpp"
 #include "opengemini/impl/util/Preprocessor.hpp"
 
 namespace opengemini::impl::cli {
 
+// The groups of servers, e.g. clusters, which every write is replicated to.
+struct Replication {
+    struct Group {
+        lb::LoadBalancer&  lb;
+        spill::SpillQueue* spill;
+    };
+
+    // The first one is the group of the client's own addresses.
+    std::vector<Group> groups;
+
+    // Number of groups which must accept a write before it completes.
+    std::size_t acks;
+
+    // A group resends a write it failed to accept so many times, waiting for
+    // the interval doubled each time, before spilling it.
+    std::size_t               retries;
+    std::chrono::milliseconds retryInterval;
+};
+
 template<typename POINT_TYPE>
 struct RunWrite : public Functor {
     void operator()(boost::asio::yield_context yield) const;
 
-    std::string db_;
-    std::string rp_;
-    POINT_TYPE  point_;
+    std::shared_ptr<const WriteTarget> target_;
+    POINT_TYPE                         point_;
+
+    // Encodes large batches of points in parallel if present.
+    const enc::ParallelEncoder* encoder_{ nullptr };
+
+    // Caches the encoded measurement and tags of points if present.
+    enc::SeriesCache* cache_{ nullptr };
+
+    // Keeps the write on disk if present and no server is available.
+    spill::SpillQueue* spill_{ nullptr };
+
+    // Sends the points of a series to the server which the series is mapped
+    // to, see LoadBalancer::PickServerOf(), instead of any available one.
+    bool routeBySeries_{ false };
+
+    // Replicates the write to every group of servers if present, in place of
+    // sending it through lb_ and spill_.
+    const Replication* replication_{ nullptr };
+
+    // Sends the body whose timestamps are in units of unit to an available
+    // server, the one which series is mapped to if present and routing by
+    // series. Returns std::nullopt if there is no server and the body is
+    // spilled, or if the body is replicated, whose responses are checked
+    // already.
+    template<typename BODY>
+    std::optional<http::Response>
+    Post(BODY                         body,
+         Precision                    unit,
+         std::optional<std::uint64_t> series,
+         boost::asio::yield_context   yield) const;
+
+    // Sends the body to every group of replication_ concurrently, returns
+    // once enough of them have accepted it. Throws the error of the first
+    // failed group if too many of them have failed.
+    template<typename BODY>
+    void PostReplicated(BODY                         body,
+                        Precision                    unit,
+                        std::optional<std::uint64_t> series,
+                        boost::asio::yield_context   yield) const;
+
+    // Splits the points by the servers their series are mapped to and sends
+    // the shares concurrently. Returns false without sending anything if no
+    // server is available.
+    bool PostBySeries(Precision unit, boost::asio::yield_context yield) const;
+
+    // Encodes the points at indexes and sends them as one request.
+    void PostShare(const std::vector<std::size_t>& indexes,
+                   std::uint64_t                   series,
+                   Precision                       unit,
+                   boost::asio::yield_context      yield) const;
 };
 
+namespace detail {
+
+// Hash of the series (measurement and tags) of a Point or PointBatch, which
+// is stable across processes.
+template<typename POINT_TYPE>
+std::uint64_t SeriesHashOf(const POINT_TYPE& point);
+
+// Throws if the server did not accept the write.
+inline void CheckWriteResponse(const http::Response& rsp);
+
+// Sends the body to an available server of the group, the one which series is
+// mapped to if present, or spills it and returns std::nullopt if there is
+// none.
+template<typename BODY>
+std::optional<http::Response> PostToGroup(http::IHttpClient&           http,
+                                          const Replication::Group&    group,
+                                          const WriteTarget&           target,
+                                          BODY                         body,
+                                          Precision                    unit,
+                                          std::optional<std::uint64_t> series,
+                                          boost::asio::yield_context   yield);
+
+// Spills the content to the spill queue of the group.
+inline void SpillToGroup(const Replication::Group& group,
+                         const WriteTarget&        target,
+                         const util::ChunkChain&   content,
+                         Precision                 unit);
+
+// Sends the content to the group, resending it as configured by replication
+// unless the server rejects it, and spills it to the group if it still fails.
+// Throws the error of the last attempt if the group does not accept it.
+inline void
+ReplicateToGroup(http::IHttpClient&                             http,
+                 const Replication&                             replication,
+                 const Replication::Group&                      group,
+                 const WriteTarget&                             target,
+                 const std::shared_ptr<const util::ChunkChain>& content,
+                 Precision                                      unit,
+                 std::optional<std::uint64_t>                   series,
+                 boost::asio::yield_context                     yield);
+
+} // namespace detail
+
+// Estimates the memory in bytes held by the points of a write.
+template<typename POINT_TYPE>
+std::size_t ApproximateSize(const POINT_TYPE& point);
+
 } // namespace opengemini::impl::cli
 
 #include "opengemini/impl/cli/write/Write.tpp"
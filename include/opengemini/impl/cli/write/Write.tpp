@@ -14,32 +14,397 @@
 
 #include "opengemini/impl/cli/write/Write.hpp"
 
-#include <boost/url.hpp>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <type_traits>
+
+#include <boost/asio/steady_timer.hpp>
 
 #include "opengemini/Exception.hpp"
-#include "opengemini/impl/comm/UrlTargets.hpp"
+#include "opengemini/impl/comm/Join.hpp"
+#include "opengemini/impl/cli/write/PointBatchBodySource.hpp"
+#include "opengemini/impl/cli/write/PointsBodySource.hpp"
+#include "opengemini/impl/cli/write/RawBodySource.hpp"
+#include "opengemini/impl/cli/write/RecordsBodySource.hpp"
 #include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+#include "opengemini/impl/util/Hash.hpp"
 
 namespace opengemini::impl::cli {
 
 template<typename POINT_TYPE>
 void RunWrite<POINT_TYPE>::operator()(boost::asio::yield_context yield) const
 {
-    if (db_.empty()) {
+    if (target_->database.empty()) {
         throw Exception(errc::LogicErrors::InvalidArgument,
                         "Database name cannot be empty");
     }
 
-    auto content = enc::LineProtocolEncoder{}.Encode(point_);
-    if (content.empty()) { return; }
+    std::optional<http::Response> rsp;
+    if constexpr (std::is_same_v<POINT_TYPE, std::vector<Point>> ||
+                  std::is_same_v<POINT_TYPE, PointSpan>) {
+        if (point_.empty()) { return; }
+
+        // Points of mixed precision are all written in the finest one.
+        auto unit = enc::LineProtocolEncoder::TimeUnitOf(point_);
+        if (routeBySeries_ && !replication_ && PostBySeries(unit, yield)) {
+            return;
+        }
+
+        std::shared_ptr<http::BodySource> body;
+        if (encoder_ && encoder_->Accept(point_)) {
+            body = std::make_shared<http::ChainBodySource>(
+                encoder_->Encode(point_, unit, cache_, yield));
+        }
+        else {
+            // Reject invalid points before sending anything, because the body
+            // is encoded while it is being sent.
+            for (auto& point : point_) {
+                enc::LineProtocolEncoder::Validate(point);
+            }
+            body = std::make_shared<PointsBodySource>(point_, unit, cache_);
+        }
+        rsp = Post(std::move(body), unit, std::nullopt, yield);
+    }
+    else if constexpr (std::is_same_v<POINT_TYPE, PointBatch>) {
+        if (point_.times.empty()) { return; }
+
+        enc::LineProtocolEncoder::Validate(point_);
+        rsp = Post(std::make_shared<PointBatchBodySource>(point_),
+                   point_.precision,
+                   detail::SeriesHashOf(point_),
+                   yield);
+    }
+    else if constexpr (std::is_same_v<POINT_TYPE, RawBody>) {
+        if (ApproximateSize(point_) == 0) { return; }
+
+        if (point_.validate) {
+            enc::LineProtocolEncoder::ValidateRaw(point_.buffers);
+        }
+        rsp = Post(std::make_shared<RawBodySource>(point_),
+                   Precision::Nanosecond,
+                   std::nullopt,
+                   yield);
+    }
+    else if constexpr (std::is_same_v<POINT_TYPE, Point>) {
+        enc::LineProtocolEncoder encoder{ cache_ };
+        encoder.SetTimeUnit(point_.precision);
+        rsp = Post(encoder.Encode(point_),
+                   point_.precision,
+                   detail::SeriesHashOf(point_),
+                   yield);
+    }
+    else {
+        // A vector of records described by Schema.
+        using RECORD = typename POINT_TYPE::value_type;
+        if (point_.empty()) { return; }
+
+        for (auto& record : point_) {
+            enc::LineProtocolEncoder::Validate(record);
+        }
+        rsp = Post(std::make_shared<RecordsBodySource<RECORD>>(point_),
+                   schema::detail::PrecisionOf<Schema<RECORD>>::value,
+                   std::nullopt,
+                   yield);
+    }
+    if (rsp) { detail::CheckWriteResponse(rsp.value()); }
+}
+
+template<typename POINT_TYPE>
+template<typename BODY>
+std::optional<http::Response>
+RunWrite<POINT_TYPE>::Post(BODY                         body,
+                           Precision                    unit,
+                           std::optional<std::uint64_t> series,
+                           boost::asio::yield_context   yield) const
+{
+    if (!routeBySeries_) { series.reset(); }
+    if (replication_) {
+        PostReplicated(std::move(body), unit, series, yield);
+        return std::nullopt;
+    }
+
+    return detail::PostToGroup(http_,
+                               { lb_, spill_ },
+                               *target_,
+                               std::move(body),
+                               unit,
+                               series,
+                               yield);
+}
+
+template<typename POINT_TYPE>
+template<typename BODY>
+void RunWrite<POINT_TYPE>::PostReplicated(
+    BODY                         body,
+    Precision                    unit,
+    std::optional<std::uint64_t> series,
+    boost::asio::yield_context   yield) const
+{
+    util::ChunkChain chain;
+    if constexpr (std::is_same_v<BODY, std::string>) { chain.Append(body); }
+    else {
+        body->Rewind();
+        while (body->Produce(chain)) { }
+        // The chain may borrow from the body or the buffers of a raw write,
+        // neither of which lives longer than this write.
+        chain.Own();
+    }
+    // Encoded once and shared by the requests to every group.
+    auto content = std::make_shared<const util::ChunkChain>(std::move(chain));
+
+    // The requests to the groups which are not waited for may outlive this
+    // write, so they hold nothing of it but the owned content.
+    std::function<std::exception_ptr()> error;
+    boost::asio::async_initiate<boost::asio::yield_context, void()>(
+        [this, unit, series, &content, &error](auto handler) {
+            auto executor = boost::asio::get_associated_executor(handler);
+            auto join = std::make_shared<QuorumJoin<decltype(handler)>>(
+                executor,
+                std::move(handler),
+                replication_->groups.size(),
+                replication_->acks);
+            error = [join] { return join->Error(); };
+            for (auto& group : replication_->groups) {
+                boost::asio::spawn(
+                    executor,
+                    [&http        = http_,
+                     &replication = *replication_,
+                     group,
+                     target = target_,
+                     content,
+                     unit,
+                     series,
+                     join](auto yield) {
+                        try {
+                            detail::ReplicateToGroup(http,
+                                                     replication,
+                                                     group,
+                                                     *target,
+                                                     content,
+                                                     unit,
+                                                     series,
+                                                     yield);
+                            join->Succeed();
+                        }
+                        catch (...) {
+                            join->Fail(std::current_exception());
+                        }
+                    },
+                    boost::asio::detached);
+            }
+        },
+        yield);
+
+    if (auto ex = error()) { std::rethrow_exception(ex); }
+}
+
+template<typename POINT_TYPE>
+bool RunWrite<POINT_TYPE>::PostBySeries(Precision                  unit,
+                                        boost::asio::yield_context yield) const
+{
+    struct Share {
+        const Endpoint*          endpoint;
+        std::uint64_t            series;
+        std::vector<std::size_t> indexes;
+        std::exception_ptr       error;
+    };
+
+    // Reject invalid points before sending any share.
+    std::vector<Share> shares;
+    try {
+        for (std::size_t idx = 0; idx < point_.size(); ++idx) {
+            enc::LineProtocolEncoder::Validate(point_[idx]);
 
-    boost::url target(url::WRITE);
-    target.set_query(fmt::format("db={}&rp={}", db_, rp_));
+            auto series   = detail::SeriesHashOf(point_[idx]);
+            auto endpoint = &lb_.PickServerOf(series);
+            auto share    = std::find_if(shares.begin(),
+                                      shares.end(),
+                                      [endpoint](const Share& each) {
+                                          return each.endpoint == endpoint;
+                                      });
+            if (share == shares.end()) {
+                share = shares.insert(shares.end(), { endpoint, series });
+            }
+            share->indexes.push_back(idx);
+        }
+    }
+    catch (const Exception& ex) {
+        if (ex.UnderlyingError().Code() !=
+            errc::ServerErrors::NoAvailableServer) {
+            throw;
+        }
+        return false;
+    }
+
+    // The shares are referenced by the tasks, it is safe because the
+    // coroutine is not resumed until the last task finishes.
+    boost::asio::async_initiate<boost::asio::yield_context, void()>(
+        [this, unit, &shares](auto handler) {
+            auto executor = boost::asio::get_associated_executor(handler);
+            auto join = std::make_shared<Join<decltype(handler)>>(
+                executor,
+                std::move(handler),
+                shares.size());
+            for (auto& share : shares) {
+                boost::asio::spawn(
+                    executor,
+                    [this, unit, &share, join](auto yield) {
+                        try {
+                            PostShare(share.indexes, share.series, unit, yield);
+                        }
+                        catch (...) {
+                            share.error = std::current_exception();
+                        }
+                        join->Finish();
+                    },
+                    boost::asio::detached);
+            }
+        },
+        yield);
+
+    for (auto& share : shares) {
+        if (share.error) { std::rethrow_exception(share.error); }
+    }
+    return true;
+}
+
+template<typename POINT_TYPE>
+void RunWrite<POINT_TYPE>::PostShare(
+    const std::vector<std::size_t>& indexes,
+    std::uint64_t                   series,
+    Precision                       unit,
+    boost::asio::yield_context      yield) const
+{
+    util::ChunkChain         chain;
+    enc::LineProtocolEncoder encoder{ cache_ };
+    encoder.SetTimeUnit(unit);
+    for (auto idx : indexes) { encoder.EncodeTo(point_[idx], chain); }
 
-    auto rsp = http_.Post(lb_.PickAvailableServer(),
-                          target.buffer(),
-                          std::move(content),
-                          yield);
+    auto rsp = Post(std::make_shared<http::ChainBodySource>(std::move(chain)),
+                    unit,
+                    series,
+                    yield);
+    if (rsp) { detail::CheckWriteResponse(rsp.value()); }
+}
+
+namespace detail {
+
+template<typename POINT_TYPE>
+std::uint64_t SeriesHashOf(const POINT_TYPE& point)
+{
+    auto hash = util::Fnv1a(point.measurement);
+    for (auto& [key, value] : point.tags) {
+        hash = util::Fnv1a(key, util::Fnv1a(",", hash));
+        hash = util::Fnv1a(value, util::Fnv1a("=", hash));
+    }
+    return util::Mix64(hash);
+}
+
+template<typename BODY>
+std::optional<http::Response> PostToGroup(http::IHttpClient&           http,
+                                          const Replication::Group&    group,
+                                          const WriteTarget&           target,
+                                          BODY                         body,
+                                          Precision                    unit,
+                                          std::optional<std::uint64_t> series,
+                                          boost::asio::yield_context   yield)
+{
+    const Endpoint* endpoint{ nullptr };
+    try {
+        endpoint = series.has_value() ? &group.lb.PickServerOf(series.value())
+                                      : &group.lb.PickAvailableServer();
+    }
+    catch (const Exception& ex) {
+        if (!group.spill || ex.UnderlyingError().Code() !=
+                                errc::ServerErrors::NoAvailableServer) {
+            throw;
+        }
+
+        if constexpr (std::is_same_v<BODY, std::string>) {
+            group.spill->Append(target.database,
+                                target.retentionPolicy,
+                                body,
+                                unit);
+        }
+        else {
+            util::ChunkChain chain;
+            body->Rewind();
+            while (body->Produce(chain)) { }
+            SpillToGroup(group, target, chain, unit);
+        }
+        return std::nullopt;
+    }
+
+    return http.Post(*endpoint,
+                     target.TargetOf(unit),
+                     std::move(body),
+                     yield);
+}
+
+inline void SpillToGroup(const Replication::Group& group,
+                         const WriteTarget&        target,
+                         const util::ChunkChain&   content,
+                         Precision                 unit)
+{
+    std::string body;
+    body.reserve(content.Size());
+    for (auto& buffer : content.Buffers()) {
+        body.append(static_cast<const char*>(buffer.data()), buffer.size());
+    }
+    group.spill->Append(target.database, target.retentionPolicy, body, unit);
+}
+
+inline void
+ReplicateToGroup(http::IHttpClient&                             http,
+                 const Replication&                             replication,
+                 const Replication::Group&                      group,
+                 const WriteTarget&                             target,
+                 const std::shared_ptr<const util::ChunkChain>& content,
+                 Precision                                      unit,
+                 std::optional<std::uint64_t>                   series,
+                 boost::asio::yield_context                     yield)
+{
+    std::exception_ptr error;
+    bool               rejected{ false };
+    auto               interval = replication.retryInterval;
+    for (std::size_t attempt = 0;; ++attempt) {
+        try {
+            auto rsp = PostToGroup(http,
+                                   group,
+                                   target,
+                                   std::make_shared<http::ChainBodySource>(
+                                       content),
+                                   unit,
+                                   series,
+                                   yield);
+            if (rsp) {
+                // Sending the content the server refuses again is useless.
+                rejected = rsp->result_int() >= 400 && rsp->result_int() < 500;
+                CheckWriteResponse(*rsp);
+            }
+            return;
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        if (rejected || attempt == replication.retries) { break; }
+
+        boost::asio::steady_timer timer(yield.get_executor(), interval);
+        timer.async_wait(yield);
+        interval *= 2;
+    }
+
+    // Kept for replay, so that a group lagging behind the others does not
+    // lose its copy even if the write has completed already.
+    if (!rejected && group.spill) {
+        SpillToGroup(group, target, *content, unit);
+    }
+    std::rethrow_exception(error);
+}
+
+inline void CheckWriteResponse(const http::Response& rsp)
+{
     if (rsp.result() != http::Status::no_content) {
         throw Exception(errc::ServerErrors::UnexpectedStatusCode,
                         fmt::format("Received code: {}, body:{}",
@@ -48,4 +413,60 @@ void RunWrite<POINT_TYPE>::operator()(boost::asio::yield_context yield) const
     }
 }
 
+} // namespace detail
+
+template<typename POINT_TYPE>
+std::size_t ApproximateSize(const POINT_TYPE& point)
+{
+    if constexpr (std::is_same_v<POINT_TYPE, Point>) {
+        auto size = sizeof(Point) + point.measurement.size();
+        for (auto& [key, value] : point.fields) {
+            size += sizeof(value) + key.size();
+            if (auto str = std::get_if<std::string>(&value)) {
+                size += str->size();
+            }
+        }
+        for (auto& [key, value] : point.tags) {
+            size += 2 * sizeof(std::string) + key.size() + value.size();
+        }
+        return size;
+    }
+    else if constexpr (std::is_same_v<POINT_TYPE, std::vector<Point>> ||
+                       std::is_same_v<POINT_TYPE, PointSpan>) {
+        std::size_t size{ 0 };
+        for (auto& each : point) { size += ApproximateSize(each); }
+        return size;
+    }
+    else if constexpr (std::is_same_v<POINT_TYPE, PointBatch>) {
+        auto size = sizeof(PointBatch) + point.measurement.size() +
+                    point.times.size() * sizeof(Point::Time);
+        for (auto& [key, column] : point.fields) {
+            size += sizeof(column) + key.size();
+            std::visit(
+                [&size](const auto& values) {
+                    using T =
+                        typename std::decay_t<decltype(values)>::value_type;
+                    size += values.size() * sizeof(T);
+                    if constexpr (std::is_same_v<T, std::string>) {
+                        for (auto& value : values) { size += value.size(); }
+                    }
+                },
+                column);
+        }
+        for (auto& [key, value] : point.tags) {
+            size += 2 * sizeof(std::string) + key.size() + value.size();
+        }
+        return size;
+    }
+    else if constexpr (std::is_same_v<POINT_TYPE, RawBody>) {
+        std::size_t size{ 0 };
+        for (auto buffer : point.buffers) { size += buffer.size(); }
+        return size;
+    }
+    else {
+        // Records described by Schema, whose dynamic storage is not known.
+        return point.size() * sizeof(typename POINT_TYPE::value_type);
+    }
+}
+
 } // namespace opengemini::impl::cli
@@ -0,0 +1,67 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_CLI_WRITE_WRITETARGET_HPP
+#define OPENGEMINI_IMPL_CLI_WRITE_WRITETARGET_HPP
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+#include "opengemini/Precision.hpp"
+#include "opengemini/impl/comm/UrlTargets.hpp"
+
+namespace opengemini::impl::cli {
+
+// The names and the request target of writes to a retention policy of a
+// database. It is built once and shared by all the writes to them, instead of
+// formatting the target for every write.
+struct WriteTarget {
+    WriteTarget(std::string database, std::string retentionPolicy) :
+        database(std::move(database)),
+        retentionPolicy(std::move(retentionPolicy)),
+        target(url::WriteTarget(this->database, this->retentionPolicy))
+    { }
+
+    // Returns the target with the precision parameter of unit, which is built
+    // on first use and kept for the following writes.
+    const std::string& TargetOf(Precision unit) const
+    {
+        if (unit == Precision::Nanosecond) { return target; }
+
+        auto idx = static_cast<std::size_t>(unit);
+        std::call_once(built_[idx], [this, unit, idx] {
+            withPrecision_[idx] = target;
+            url::AppendPrecision(withPrecision_[idx], unit);
+        });
+        return withPrecision_[idx];
+    }
+
+    const std::string database;
+    const std::string retentionPolicy;
+    const std::string target;
+
+private:
+    static constexpr std::size_t PRECISIONS{
+        static_cast<std::size_t>(Precision::Hour) + 1
+    };
+
+    mutable std::array<std::once_flag, PRECISIONS> built_;
+    mutable std::array<std::string, PRECISIONS>    withPrecision_;
+};
+
+} // namespace opengemini::impl::cli
+
+#endif // !OPENGEMINI_IMPL_CLI_WRITE_WRITETARGET_HPP
@@ -19,13 +19,17 @@
 #include <string>
 #include <vector>
 
+#include "opengemini/ColumnarResult.hpp"
 #include "opengemini/Query.hpp"
 #include "opengemini/RetentionPolicy.hpp"
 
 namespace opengemini::impl::sig {
 
-using Ping  = void(std::exception_ptr, std::string);
-using Query = void(std::exception_ptr, QueryResult);
+using Ping         = void(std::exception_ptr, std::string);
+using Query        = void(std::exception_ptr, QueryResult);
+using QueryChunked = void(std::exception_ptr);
+
+using ColumnarQuery = void(std::exception_ptr, ColumnarQueryResult);
 
 using CreateDatabase = void(std::exception_ptr);
 using ShowDatabase   = void(std::exception_ptr, std::vector<std::string>);
@@ -81,4 +81,10 @@ boost::asio::io_context& Context::operator()() noexcept
     return ctx_;
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+std::size_t Context::Concurrency() const noexcept
+{
+    return threads_.size();
+}
+
 } // namespace opengemini::impl
@@ -31,6 +31,9 @@ public:
 
     boost::asio::io_context& operator()() noexcept;
 
+    // Number of threads running the io_context.
+    std::size_t Concurrency() const noexcept;
+
 private:
     Context(const Context&)                = delete;
     Context(Context&&) noexcept            = delete;
@@ -0,0 +1,113 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_COMM_JOIN_HPP
+#define OPENGEMINI_IMPL_COMM_JOIN_HPP
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+#include <boost/asio.hpp>
+
+namespace opengemini::impl {
+
+// Resumes the waiting coroutine once every one of a number of concurrent
+// tasks has finished, handler is posted to executor by the last one.
+template<typename HANDLER>
+class Join {
+public:
+    Join(boost::asio::any_io_executor executor,
+         HANDLER                      handler,
+         std::size_t                  pending) :
+        executor_(std::move(executor)),
+        handler_(std::move(handler)),
+        pending_(pending)
+    { }
+
+    void Finish()
+    {
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            boost::asio::post(executor_, std::move(handler_));
+        }
+    }
+
+private:
+    boost::asio::any_io_executor executor_;
+    HANDLER                      handler_;
+    std::atomic<std::size_t>     pending_;
+};
+
+// Resumes the waiting coroutine as soon as needed of total concurrent tasks
+// have succeeded, or once so many of them have failed that it can no longer
+// happen. The tasks finishing later are not waited for, so they should not
+// reference anything owned by the coroutine.
+template<typename HANDLER>
+class QuorumJoin {
+public:
+    QuorumJoin(boost::asio::any_io_executor executor,
+               HANDLER                      handler,
+               std::size_t                  total,
+               std::size_t                  needed) :
+        executor_(std::move(executor)),
+        handler_(std::move(handler)),
+        needed_(needed),
+        failures_(total - needed + 1)
+    { }
+
+    void Succeed()
+    {
+        if (succeeded_.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+            needed_) {
+            boost::asio::post(executor_, std::move(handler_));
+        }
+    }
+
+    void Fail(std::exception_ptr error)
+    {
+        {
+            std::lock_guard lock(mutex_);
+            if (!error_) { error_ = std::move(error); }
+        }
+        if (failed_.fetch_add(1, std::memory_order_acq_rel) + 1 == failures_) {
+            boost::asio::post(executor_, std::move(handler_));
+        }
+    }
+
+    // The error of the first failed task if too many of them have failed,
+    // called after the coroutine is resumed.
+    std::exception_ptr Error()
+    {
+        if (succeeded_.load(std::memory_order_acquire) >= needed_) {
+            return nullptr;
+        }
+        std::lock_guard lock(mutex_);
+        return error_;
+    }
+
+private:
+    boost::asio::any_io_executor executor_;
+    HANDLER                      handler_;
+    const std::size_t            needed_;
+    const std::size_t            failures_;
+    std::atomic<std::size_t>     succeeded_{ 0 };
+    std::atomic<std::size_t>     failed_{ 0 };
+    std::mutex                   mutex_;
+    std::exception_ptr           error_;
+};
+
+} // namespace opengemini::impl
+
+#endif // !OPENGEMINI_IMPL_COMM_JOIN_HPP
@@ -15,12 +15,44 @@
 #ifndef OPENGEMINI_IMPL_COMM_URLTARGETS_HPP
 #define OPENGEMINI_IMPL_COMM_URLTARGETS_HPP
 
+#include <string>
+#include <string_view>
+
+#include "opengemini/Precision.hpp"
+#include "opengemini/impl/util/PercentEncode.hpp"
+
 namespace opengemini::impl::url {
 
 inline constexpr auto PING  = "/ping";
 inline constexpr auto QUERY = "/query";
 inline constexpr auto WRITE = "/write";
 
+// Builds the target of writing to the retention policy of the database, the
+// names are percent-encoded.
+inline std::string WriteTarget(std::string_view database,
+                               std::string_view retentionPolicy)
+{
+    std::string target{ WRITE };
+    target.reserve(target.size() + database.size() +
+                   retentionPolicy.size() + 8);
+    target.append("?db=");
+    util::PercentEncodeTo(database, target);
+    target.append("&rp=");
+    util::PercentEncodeTo(retentionPolicy, target);
+    return target;
+}
+
+// Appends the precision parameter to a write target, which tells the server
+// the unit of the timestamps in the body. Nanosecond is the default of the
+// server and is left out.
+inline void AppendPrecision(std::string& target, Precision precision)
+{
+    if (precision != Precision::Nanosecond) {
+        target.append("&precision=");
+        target.append(ToString(precision));
+    }
+}
+
 } // namespace opengemini::impl::url
 
 #endif // !OPENGEMINI_IMPL_COMM_URLTARGETS_HPP
@@ -0,0 +1,174 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/comm/WriteLimiter.hpp"
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl {
+
+OPENGEMINI_INLINE_SPECIFIER
+WriteLimiter::WriteLimiter(boost::asio::io_context&  ctx,
+                           const BackpressureConfig& config) :
+    TaskSlot(ctx),
+    config_(config)
+{ }
+
+OPENGEMINI_INLINE_SPECIFIER
+void WriteLimiter::Submit(std::size_t size, Task task)
+{
+    std::vector<Task> dropped;
+    bool              send{ false };
+    bool              stopped{ false };
+    {
+        std::unique_lock lock(mutex_);
+        auto             accepted = !ExceedsLocked(size);
+        if (!accepted) {
+            switch (config_.overflowPolicy) {
+            case OverflowPolicy::Block:
+                // Blocking the threads of the client would keep the writes in
+                // flight from completing and releasing their room.
+                if (!ctx_.get_executor().running_in_this_thread()) {
+                    released_.wait(lock, [this, size] {
+                        return stopped_ || !ExceedsLocked(size);
+                    });
+                }
+                accepted = true;
+                break;
+            case OverflowPolicy::Fail: break;
+            case OverflowPolicy::DropOldest:
+                while (!queue_.empty() && ExceedsLocked(size)) {
+                    bytes_ -= queue_.front().size;
+                    dropped.push_back(std::move(queue_.front().task));
+                    queue_.pop_front();
+                    ++dropped_;
+                }
+                accepted = !ExceedsLocked(size);
+                break;
+            }
+        }
+
+        if (stopped_) {
+            stopped = true;
+            ++dropped_;
+        }
+        else if (!accepted) { ++rejected_; }
+        else {
+            bytes_ += size;
+            if (config_.maxInflightRequests == 0 ||
+                sending_ < config_.maxInflightRequests) {
+                ++sending_;
+                send = true;
+            }
+            else {
+                queue_.push_back({ size, std::move(task) });
+            }
+        }
+    }
+
+    for (auto& drop : dropped) {
+        Fail(std::move(drop),
+             errc::RuntimeErrors::WriteDropped,
+             "Dropped to make room for a newer write");
+    }
+    if (send) { task(nullptr); }
+    else if (stopped) {
+        // The context may have been stopped, as in Stop().
+        task(std::make_exception_ptr(
+            Exception(errc::RuntimeErrors::WriteDropped,
+                      "The client is being destroyed")));
+    }
+    else if (task) {
+        Fail(std::move(task),
+             errc::RuntimeErrors::WriteQueueFull,
+             "The limits of writes held by the client are reached");
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void WriteLimiter::Complete(std::size_t size)
+{
+    Task next;
+    {
+        std::lock_guard lock(mutex_);
+        bytes_ -= size;
+        if (!queue_.empty()) {
+            next = std::move(queue_.front().task);
+            queue_.pop_front();
+        }
+        else {
+            --sending_;
+        }
+    }
+    released_.notify_all();
+
+    if (next) { next(nullptr); }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void WriteLimiter::Stop()
+{
+    std::deque<Queued> queue;
+    {
+        std::lock_guard lock(mutex_);
+        stopped_ = true;
+        for (auto& queued : queue_) { bytes_ -= queued.size; }
+        dropped_ += queue_.size();
+        std::swap(queue, queue_);
+    }
+    released_.notify_all();
+
+    // The context may have been stopped, so fail them in place.
+    for (auto& queued : queue) {
+        queued.task(std::make_exception_ptr(
+            Exception(errc::RuntimeErrors::WriteDropped,
+                      "The client is being destroyed")));
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+struct WriteQueueStats WriteLimiter::Stats() const
+{
+    std::lock_guard lock(mutex_);
+    return { sending_, queue_.size(), bytes_, rejected_, dropped_ };
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+bool WriteLimiter::ExceedsLocked(std::size_t size) const
+{
+    // A write larger than the limit is accepted when nothing else is held,
+    // otherwise it would never be.
+    if (config_.maxInflightBytes != 0 && bytes_ != 0 &&
+        bytes_ + size > config_.maxInflightBytes) {
+        return true;
+    }
+    return config_.maxInflightRequests != 0 && config_.maxQueuedRequests != 0 &&
+           sending_ >= config_.maxInflightRequests &&
+           queue_.size() >= config_.maxQueuedRequests;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void WriteLimiter::Fail(Task task, errc::RuntimeErrors error, const char* info)
+{
+    boost::asio::post(
+        ctx_,
+        [task  = std::move(task),
+         error = std::make_exception_ptr(Exception(error, info))] {
+            task(error);
+        });
+}
+
+} // namespace opengemini::impl
@@ -0,0 +1,89 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_COMM_WRITELIMITER_HPP
+#define OPENGEMINI_IMPL_COMM_WRITELIMITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "opengemini/ClientConfig.hpp"
+#include "opengemini/Error.hpp"
+#include "opengemini/WriteQueueStats.hpp"
+#include "opengemini/impl/comm/TaskSlot.hpp"
+
+namespace opengemini::impl {
+
+// Bounds the writes held by a client according to BackpressureConfig. A write
+// is held from Submit() until Complete() is called for it.
+class WriteLimiter : public TaskSlot {
+public:
+    // Sends the write if error is null, otherwise completes the write with
+    // error without sending it.
+    using Task = std::function<void(std::exception_ptr error)>;
+
+public:
+    WriteLimiter(boost::asio::io_context&  ctx,
+                 const BackpressureConfig& config);
+
+    // Accepts a write of size bytes, task is invoked once it may be sent, or
+    // with an error if it is rejected or dropped. May block the caller if the
+    // policy is OverflowPolicy::Block.
+    void Submit(std::size_t size, Task task);
+
+    // Releases a write whose task was invoked without error, and sends the
+    // next queued one if any.
+    void Complete(std::size_t size);
+
+    // Fails the queued writes and the following submitted ones, wakes up the
+    // blocked callers.
+    void Stop();
+
+    struct WriteQueueStats Stats() const;
+
+private:
+    struct Queued {
+        std::size_t size;
+        Task        task;
+    };
+
+private:
+    bool ExceedsLocked(std::size_t size) const;
+
+    void Fail(Task task, errc::RuntimeErrors error, const char* info);
+
+private:
+    const BackpressureConfig config_;
+
+    std::deque<Queued>      queue_;
+    std::size_t             sending_{ 0 };
+    std::size_t             bytes_{ 0 };
+    std::uint64_t           rejected_{ 0 };
+    std::uint64_t           dropped_{ 0 };
+    bool                    stopped_{ false };
+    mutable std::mutex      mutex_;
+    std::condition_variable released_;
+};
+
+} // namespace opengemini::impl
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/comm/WriteLimiter.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_COMM_WRITELIMITER_HPP
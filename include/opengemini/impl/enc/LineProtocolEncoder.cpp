@@ -16,10 +16,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <type_traits>
 
+#include <fmt/format.h>
+
 #include "opengemini/Exception.hpp"
 #include "opengemini/Precision.hpp"
+#include "opengemini/impl/util/FindFirstOf.hpp"
 
 namespace opengemini::impl::enc {
 
@@ -34,44 +38,252 @@ inline auto Round(const Point::Time& time)
         .count();
 }
 
+inline int64_t NanosecondsOf(Precision precision)
+{
+    using namespace std::chrono;
+
+    switch (precision) {
+    case Precision::Nanosecond: return 1;
+    case Precision::Microsecond: return nanoseconds(microseconds(1)).count();
+    case Precision::Millisecond: return nanoseconds(milliseconds(1)).count();
+    case Precision::Second: return nanoseconds(seconds(1)).count();
+    case Precision::Minute: return nanoseconds(minutes(1)).count();
+    case Precision::Hour: return nanoseconds(hours(1)).count();
+    }
+    return 1;
+}
+
+// Makes an unambiguous key from the parts of a series identity.
+inline void AppendKeyPart(std::string& key, std::string_view part)
+{
+    auto size = static_cast<uint32_t>(part.size());
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(part);
+}
+
+inline void CheckMeasurement(std::string_view measurement)
+{
+    if (measurement.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "The filed <measurement> in Point must not be empty");
+    }
+}
+
+inline void CheckFields(const decltype(Point::fields)& fields)
+{
+    if (fields.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "The filed <fields> in Point must not be empty");
+    }
+}
+
+inline void CheckColumns(const PointBatch& batch)
+{
+    if (batch.fields.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "The filed <fields> in PointBatch must not be empty");
+    }
+    for (auto& [key, column] : batch.fields) {
+        auto size = std::visit(
+            [](const auto& values) { return values.size(); }, column);
+        if (size != batch.times.size()) {
+            throw Exception(errc::LogicErrors::InvalidArgument,
+                            fmt::format("The column <{}> in PointBatch has {} "
+                                        "values, but there are {} times",
+                                        key,
+                                        size,
+                                        batch.times.size()));
+        }
+    }
+}
+
 } // namespace
 
+OPENGEMINI_INLINE_SPECIFIER
+LineProtocolEncoder::LineProtocolEncoder(std::string buffer) :
+    buffer_(std::move(buffer))
+{
+    buffer_.clear();
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+LineProtocolEncoder::LineProtocolEncoder(SeriesCache* cache) : cache_(cache)
+{ }
+
 OPENGEMINI_INLINE_SPECIFIER
 std::string LineProtocolEncoder::Encode(const Point& point)
 {
+    buffer_.clear();
     AppendPoint(point);
-    return os_.str();
+    return std::move(buffer_);
 }
 
 OPENGEMINI_INLINE_SPECIFIER
 std::string LineProtocolEncoder::Encode(const std::vector<Point>& points)
 {
+    buffer_.clear();
     for (auto& point : points) {
         AppendPoint(point);
         Append(ELEMENT_LF);
     }
 
-    return os_.str();
+    return std::move(buffer_);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::string LineProtocolEncoder::Encode(const PointBatch& batch)
+{
+    buffer_.clear();
+    for (std::size_t begin = 0; begin < batch.times.size();
+         begin += BATCH_BLOCK_ROWS) {
+        AppendRows(batch,
+                   begin,
+                   std::min(begin + BATCH_BLOCK_ROWS, batch.times.size()));
+    }
+
+    return std::move(buffer_);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::EncodeTo(const Point& point, util::ChunkChain& chain)
+{
+    buffer_.clear();
+    AppendPoint(point);
+    Append(ELEMENT_LF);
+    chain.Append(buffer_);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::EncodeTo(const PointBatch& batch,
+                                   std::size_t       begin,
+                                   std::size_t       end,
+                                   util::ChunkChain& chain)
+{
+    buffer_.clear();
+    AppendRows(batch, begin, end);
+    chain.Append(buffer_);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::Validate(const Point& point)
+{
+    CheckMeasurement(point.measurement);
+    CheckFields(point.fields);
+    for (auto& [_, value] : point.fields) {
+        if (auto number = std::get_if<double>(&value)) { CheckFloat(*number); }
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::Validate(const PointBatch& batch)
+{
+    CheckMeasurement(batch.measurement);
+    CheckColumns(batch);
+    for (auto& [_, column] : batch.fields) {
+        if (auto numbers = std::get_if<std::vector<double>>(&column)) {
+            std::for_each(numbers->begin(), numbers->end(), CheckFloat);
+        }
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+Precision LineProtocolEncoder::TimeUnitOf(PointSpan points) noexcept
+{
+    // Precisions are declared from the finest to the coarsest.
+    auto unit = Precision::Hour;
+    for (auto& point : points) { unit = std::min(unit, point.precision); }
+    return points.empty() ? Precision::Nanosecond : unit;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::ValidateRaw(
+    const std::vector<std::string_view>& buffers)
+{
+    // A line may be split across buffers, even between a backslash and the
+    // character it escapes.
+    std::size_t line{ 1 };
+    bool        inLine{ false };
+    bool        escaped{ false };
+    bool        inFields{ false };
+    bool        checked{ false };
+    auto        checkLineEnd = [&] {
+        if (inLine && !checked) {
+            throw Exception(errc::LogicErrors::InvalidArgument,
+                            fmt::format("Line {} has no field set", line));
+        }
+    };
+
+    for (auto data : buffers) {
+        for (std::size_t pos = 0; pos < data.size(); ++pos) {
+            // Nothing else is checked in the rest of the line.
+            if (checked && (pos = data.find(ELEMENT_LF, pos)) == data.npos) {
+                break;
+            }
+
+            auto ch = data[pos];
+            if (ch == ELEMENT_LF) {
+                checkLineEnd();
+                inLine = escaped = inFields = checked = false;
+                ++line;
+                continue;
+            }
+            if (!inLine) {
+                if (ch == ELEMENT_COMMA) {
+                    throw Exception(
+                        errc::LogicErrors::InvalidArgument,
+                        fmt::format("Line {} has no measurement", line));
+                }
+                // Comments have no field set.
+                checked = ch == '#';
+                inLine  = true;
+            }
+
+            // An escaped space belongs to the measurement or a tag, rather
+            // than separating the field set from them.
+            if (escaped) { escaped = false; }
+            else if (ch == '\\') { escaped = true; }
+            else if (ch == ELEMENT_SPACE) { inFields = true; }
+            else if (inFields && ch == ELEMENT_EQUAL) { checked = true; }
+        }
+    }
+    checkLineEnd();
 }
 
 OPENGEMINI_INLINE_SPECIFIER
 void LineProtocolEncoder::AppendPoint(const Point& point)
 {
     auto& [measurement, fields, time, tags, precision] = point;
-    AppendMeasurement(measurement);
-    AppendTags(tags);
+    if (cache_) { AppendSeries(measurement, tags); }
+    else {
+        AppendMeasurement(measurement);
+        AppendTags(tags);
+    }
     AppendFields(fields);
     AppendTimestamp(time, precision);
 }
 
 OPENGEMINI_INLINE_SPECIFIER
-void LineProtocolEncoder::AppendMeasurement(std::string_view measurement)
+void LineProtocolEncoder::AppendSeries(std::string_view             measurement,
+                                       const decltype(Point::tags)& tags)
 {
-    if (measurement.empty()) {
-        throw Exception(errc::LogicErrors::InvalidArgument,
-                        "The filed <measurement> in Point must not be empty");
+    key_.clear();
+    AppendKeyPart(key_, measurement);
+    for (auto& [key, value] : tags) {
+        AppendKeyPart(key_, key);
+        AppendKeyPart(key_, value);
     }
+    if (cache_->Lookup(key_, buffer_)) { return; }
+
+    auto begin = buffer_.size();
+    AppendMeasurement(measurement);
+    AppendTags(tags);
+    cache_->Insert(key_, std::string_view(buffer_).substr(begin));
+}
 
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::AppendMeasurement(std::string_view measurement)
+{
+    CheckMeasurement(measurement);
     AppendEscapeString(measurement, ESCAPE_CHARS_MEASUREMENT);
 }
 
@@ -89,10 +301,7 @@ void LineProtocolEncoder::AppendTags(const decltype(Point::tags)& tags)
 OPENGEMINI_INLINE_SPECIFIER
 void LineProtocolEncoder::AppendFields(const decltype(Point::fields)& fields)
 {
-    if (fields.empty()) {
-        throw Exception(errc::LogicErrors::InvalidArgument,
-                        "The filed <fields> in Point must not be empty");
-    }
+    CheckFields(fields);
 
     Append(ELEMENT_SPACE);
     std::for_each_n(fields.begin(),
@@ -105,24 +314,31 @@ void LineProtocolEncoder::AppendFields(const decltype(Point::fields)& fields)
 }
 
 OPENGEMINI_INLINE_SPECIFIER
-void LineProtocolEncoder::AppendTimestamp(const Point::Time& time,
-                                          Precision          precision)
+int64_t LineProtocolEncoder::TimestampOf(const Point::Time& time,
+                                         Precision          precision) noexcept
 {
     using namespace std::chrono;
 
-    int64_t count{ 0 };
     switch (precision) {
-    case Precision::Nanosecond: count = time.time_since_epoch().count(); break;
-    case Precision::Microsecond: count = Round<microseconds>(time); break;
-    case Precision::Millisecond: count = Round<milliseconds>(time); break;
-    case Precision::Second: count = Round<seconds>(time); break;
-    case Precision::Minute: count = Round<minutes>(time); break;
-    case Precision::Hour: count = Round<hours>(time); break;
+    case Precision::Nanosecond: return time.time_since_epoch().count();
+    case Precision::Microsecond: return Round<microseconds>(time);
+    case Precision::Millisecond: return Round<milliseconds>(time);
+    case Precision::Second: return Round<seconds>(time);
+    case Precision::Minute: return Round<minutes>(time);
+    case Precision::Hour: return Round<hours>(time);
     }
+    return 0;
+}
 
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::AppendTimestamp(const Point::Time& time,
+                                          Precision          precision)
+{
+    auto count = TimestampOf(time, precision);
     if (count != 0) {
         Append(ELEMENT_SPACE);
-        Append(count);
+        Append(unit_ == Precision::Nanosecond ? count
+                                              : count / NanosecondsOf(unit_));
     }
 }
 
@@ -166,13 +382,121 @@ void LineProtocolEncoder::AppendField(
         value);
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::AppendRows(const PointBatch& batch,
+                                     std::size_t       begin,
+                                     std::size_t       end)
+{
+    CheckColumns(batch);
+    assert(begin <= end && end <= batch.times.size());
+
+    // Encodes the shared prefix, the field keys and then every column into
+    // columns_ with one loop per column, recording where each piece ends.
+    std::swap(buffer_, columns_);
+    buffer_.clear();
+    ends_.clear();
+    AppendMeasurement(batch.measurement);
+    AppendTags(batch.tags);
+    ends_.push_back(buffer_.size());
+    for (auto& [key, _] : batch.fields) {
+        AppendEscapeString(key, ESCAPE_CHARS_FIELD_KEY);
+        Append(ELEMENT_EQUAL);
+        ends_.push_back(buffer_.size());
+    }
+    for (auto& [_, column] : batch.fields) { AppendColumn(column, begin, end); }
+    for (auto row = begin; row < end; ++row) {
+        AppendTimestamp(batch.times[row], batch.precision);
+        ends_.push_back(buffer_.size());
+    }
+    std::swap(buffer_, columns_);
+
+    // Joins the pieces row by row.
+    const std::string_view columns(columns_);
+    const auto             piece = [&columns, this](std::size_t idx) {
+        return columns.substr(ends_[idx - 1], ends_[idx] - ends_[idx - 1]);
+    };
+    const auto prefix = columns.substr(0, ends_[0]);
+    const auto fields = batch.fields.size();
+    const auto rows   = end - begin;
+    for (std::size_t row = 0; row < rows; ++row) {
+        buffer_.append(prefix);
+        for (std::size_t field = 0; field < fields; ++field) {
+            Append(field == 0 ? ELEMENT_SPACE : ELEMENT_COMMA);
+            buffer_.append(piece(1 + field));
+            buffer_.append(piece(1 + fields + field * rows + row));
+        }
+        buffer_.append(piece(1 + fields + fields * rows + row));
+        Append(ELEMENT_LF);
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::AppendColumn(const PointBatch::Column& column,
+                                       std::size_t               begin,
+                                       std::size_t               end)
+{
+    std::visit(
+        [this, begin, end](const auto& values) {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+
+            for (auto row = begin; row < end; ++row) {
+                if constexpr (std::is_same_v<T, std::string>) {
+                    Append(ELEMENT_DQUOTE);
+                    AppendEscapeString(values[row], ESCAPE_CHARS_FIELD_VALUE);
+                    Append(ELEMENT_DQUOTE);
+                }
+                else if constexpr (std::is_same_v<T, uint64_t>) {
+                    Append(values[row]);
+                    Append(ELEMENT_UINT);
+                }
+                else if constexpr (std::is_same_v<T, int64_t>) {
+                    Append(values[row]);
+                    Append(ELEMENT_INT);
+                }
+                else if constexpr (std::is_same_v<T, bool>) {
+                    Append(values[row] ? ELEMENT_TRUE : ELEMENT_FALSE);
+                }
+                else {
+                    Append(values[row]);
+                }
+                ends_.push_back(buffer_.size());
+            }
+        },
+        column);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::Append(double value)
+{
+    CheckFloat(value);
+
+    // Writes the shortest representation which round-trips to the same value.
+    char buffer[32];
+    auto end = fmt::format_to(buffer, "{}", value);
+    buffer_.append(buffer, end);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void LineProtocolEncoder::CheckFloat(double value)
+{
+    if (!std::isfinite(value)) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "NaN and infinity are not supported as field value");
+    }
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 void LineProtocolEncoder::AppendEscapeString(std::string_view origin,
                                              std::string_view escapes)
 {
-    for (auto ch : origin) {
-        if (escapes.find(ch) != escapes.npos) { Append(ELEMENT_BSLASH); }
-        Append(ch);
+    while (!origin.empty()) {
+        auto pos = util::FindFirstOf(origin, escapes);
+        buffer_.append(origin.data(), pos);
+        if (pos == origin.size()) { break; }
+
+        Append(ELEMENT_BSLASH);
+        Append(origin[pos]);
+        origin.remove_prefix(pos + 1);
     }
 }
 
@@ -15,39 +15,151 @@
 #ifndef OPENGEMINI_IMPL_ENC_LINEPROTOCOLENCODER_HPP
 #define OPENGEMINI_IMPL_ENC_LINEPROTOCOLENCODER_HPP
 
-#include <sstream>
+#include <charconv>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "opengemini/Point.hpp"
+#include "opengemini/PointBatch.hpp"
+#include "opengemini/PointSpan.hpp"
+#include "opengemini/Schema.hpp"
+#include "opengemini/impl/enc/SeriesCache.hpp"
+#include "opengemini/impl/util/ChunkChain.hpp"
 #include "opengemini/impl/util/Preprocessor.hpp"
 
 namespace opengemini::impl::enc {
 
 class LineProtocolEncoder {
 public:
+    LineProtocolEncoder() = default;
+
+    // Reuse the storage of a previously encoded content, its capacity is kept
+    // but the content is discarded.
+    explicit LineProtocolEncoder(std::string buffer);
+
+    // Looks up the escaped measurement and tags of points in cache, which
+    // must outlive the encoder. A null cache is ignored.
+    explicit LineProtocolEncoder(SeriesCache* cache);
+
+    // Writes timestamps in units of precision instead of nanoseconds, which
+    // must be the same as or finer than the precision of every encoded point
+    // so that no rounding is lost. The request carrying the lines must have
+    // the matching precision parameter.
+    void SetTimeUnit(Precision unit) noexcept { unit_ = unit; }
+
+    // Returns the finest precision of the points, which is the coarsest unit
+    // all of their timestamps can be written in.
+    static Precision TimeUnitOf(PointSpan points) noexcept;
+
+    // Returns the nanoseconds since epoch of time rounded to precision, which
+    // is 0 if the line is written without a timestamp and stamped by the
+    // server on arrival.
+    static int64_t TimestampOf(const Point::Time& time,
+                               Precision          precision) noexcept;
+
+    // The encoded content is moved out, leaving the encoder empty.
     std::string Encode(const Point& point);
     std::string Encode(const std::vector<Point>& points);
+    std::string Encode(const PointBatch& batch);
+
+    // Encodes records described by Schema<RECORD>.
+    template<typename RECORD,
+             typename = std::enable_if_t<HasSchema_v<RECORD>>>
+    std::string Encode(const RECORD& record);
+    template<typename RECORD,
+             typename = std::enable_if_t<HasSchema_v<RECORD>>>
+    std::string Encode(const std::vector<RECORD>& records);
+
+    // Appends the point to chain as one line terminated by LF.
+    void EncodeTo(const Point& point, util::ChunkChain& chain);
+
+    // Appends the points in rows [begin, end) of batch to chain, each as one
+    // line terminated by LF.
+    void EncodeTo(const PointBatch& batch,
+                  std::size_t       begin,
+                  std::size_t       end,
+                  util::ChunkChain& chain);
+
+    // Appends the record to chain as one line terminated by LF.
+    template<typename RECORD,
+             typename = std::enable_if_t<HasSchema_v<RECORD>>>
+    void EncodeTo(const RECORD& record, util::ChunkChain& chain);
+
+    // Throws if the point cannot be encoded.
+    static void Validate(const Point& point);
+    static void Validate(const PointBatch& batch);
+    template<typename RECORD,
+             typename = std::enable_if_t<HasSchema_v<RECORD>>>
+    static void Validate(const RECORD& record);
+
+    // Throws if the line protocol held in buffers is obviously malformed,
+    // that is a line starts with a comma, or has no unescaped space followed
+    // by a field. The lines are scanned rather than parsed, so passing it does
+    // not mean they are valid.
+    static void ValidateRaw(const std::vector<std::string_view>& buffers);
 
 private:
     void AppendPoint(const Point& point);
 
+    void AppendSeries(std::string_view             measurement,
+                      const decltype(Point::tags)& tags);
     void AppendMeasurement(std::string_view measurement);
     void AppendTags(const decltype(Point::tags)& tags);
     void AppendFields(const decltype(Point::fields)& fields);
     void AppendTimestamp(const Point::Time& time, Precision precision);
 
     void AppendField(const decltype(Point::fields)::value_type& field);
+
+    void AppendRows(const PointBatch& batch,
+                    std::size_t       begin,
+                    std::size_t       end);
+    void AppendColumn(const PointBatch::Column& column,
+                      std::size_t               begin,
+                      std::size_t               end);
+
+    // The keys of a record are escaped at compile time, only the tag values
+    // and field values are encoded here.
+    template<typename RECORD>
+    void AppendRecord(const RECORD& record);
+    template<typename T>
+    void AppendValue(const T& value);
+
     void AppendEscapeString(std::string_view origin, std::string_view escapes);
 
+    void Append(char ch) { buffer_.push_back(ch); }
+
+    void Append(double value);
+
+    // Throws if the field value cannot be encoded, which only happens to NaN
+    // and infinity.
     template<typename T>
-    void Append(T&& t)
+    static void CheckValue(const T& value);
+    static void CheckFloat(double value);
+
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    void Append(T value)
     {
-        os_ << std::forward<T>(t);
+        char buffer[32];
+        auto [end, _] =
+            std::to_chars(std::begin(buffer), std::end(buffer), value);
+        buffer_.append(buffer, end);
     }
 
 private:
-    std::ostringstream os_;
+    // Number of rows of a PointBatch encoded at a time.
+    static constexpr std::size_t BATCH_BLOCK_ROWS{ 1024 };
+
+    std::string  buffer_;
+    SeriesCache* cache_{ nullptr };
+    std::string  key_;
+    Precision    unit_{ Precision::Nanosecond };
+
+    // Scratch of encoding a PointBatch, holds the encoded columns and the end
+    // offset of every value in them.
+    std::string              columns_;
+    std::vector<std::size_t> ends_;
 
     static constexpr auto ELEMENT_LF{ '\n' };
     static constexpr auto ELEMENT_EOF{ '\0' };
@@ -90,6 +202,7 @@ private:
 
 } // namespace opengemini::impl::enc
 
+#include "opengemini/impl/enc/LineProtocolEncoder.tpp"
 #ifndef OPENGEMINI_SEPARATE_COMPILATION
 #    include "opengemini/impl/enc/LineProtocolEncoder.cpp"
 #endif // !OPENGEMINI_SEPARATE_COMPILATION
@@ -0,0 +1,132 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+
+#include <tuple>
+
+namespace opengemini::impl::enc {
+
+template<typename RECORD, typename>
+std::string LineProtocolEncoder::Encode(const RECORD& record)
+{
+    buffer_.clear();
+    AppendRecord(record);
+    return std::move(buffer_);
+}
+
+template<typename RECORD, typename>
+std::string LineProtocolEncoder::Encode(const std::vector<RECORD>& records)
+{
+    buffer_.clear();
+    for (auto& record : records) {
+        AppendRecord(record);
+        Append(ELEMENT_LF);
+    }
+
+    return std::move(buffer_);
+}
+
+template<typename RECORD, typename>
+void LineProtocolEncoder::EncodeTo(const RECORD&     record,
+                                   util::ChunkChain& chain)
+{
+    buffer_.clear();
+    AppendRecord(record);
+    Append(ELEMENT_LF);
+    chain.Append(buffer_);
+}
+
+template<typename RECORD, typename>
+void LineProtocolEncoder::Validate(const RECORD& record)
+{
+    std::apply(
+        [&record](const auto&... fields) {
+            (CheckValue(record.*fields.member), ...);
+        },
+        Schema<RECORD>::fields);
+}
+
+template<typename RECORD>
+void LineProtocolEncoder::AppendRecord(const RECORD& record)
+{
+    using SCHEMA = Schema<RECORD>;
+    static_assert(std::tuple_size_v<decltype(SCHEMA::fields)> > 0,
+                  "The fields of a schema must not be empty");
+
+    buffer_.append(SCHEMA::measurement.escaped.View());
+    std::apply(
+        [this, &record](const auto&... tags) {
+            ((buffer_.append(tags.escaped.View()),
+              AppendEscapeString(record.*tags.member, ESCAPE_CHARS_TAG)),
+             ...);
+        },
+        SCHEMA::tags);
+    std::apply(
+        [this, &record](const auto& first, const auto&... rest) {
+            // The first field is separated from the tags by a space instead of
+            // the comma its escaped key starts with.
+            Append(ELEMENT_SPACE);
+            buffer_.append(first.escaped.View().substr(1));
+            AppendValue(record.*first.member);
+            ((buffer_.append(rest.escaped.View()),
+              AppendValue(record.*rest.member)),
+             ...);
+        },
+        SCHEMA::fields);
+    AppendTimestamp(record.*SCHEMA::time,
+                    schema::detail::PrecisionOf<SCHEMA>::value);
+}
+
+template<typename T>
+void LineProtocolEncoder::CheckValue(const T& value)
+{
+    // Only floating point values may be unable to be encoded.
+    if constexpr (std::is_floating_point_v<T>) {
+        CheckFloat(static_cast<double>(value));
+    }
+}
+
+template<typename T>
+void LineProtocolEncoder::AppendValue(const T& value)
+{
+    // Append(char) would write the character itself rather than its code.
+    static_assert(!std::is_same_v<T, char> && !std::is_same_v<T, wchar_t> &&
+                      !std::is_same_v<T, char16_t> &&
+                      !std::is_same_v<T, char32_t>,
+                  "Character types are not supported as field value type, use "
+                  "std::int8_t or std::uint8_t for a one-byte integer");
+
+    if constexpr (std::is_same_v<T, bool>) {
+        Append(value ? ELEMENT_TRUE : ELEMENT_FALSE);
+    }
+    else if constexpr (std::is_integral_v<T>) {
+        Append(value);
+        Append(std::is_signed_v<T> ? ELEMENT_INT : ELEMENT_UINT);
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+        Append(static_cast<double>(value));
+    }
+    else {
+        static_assert(std::is_convertible_v<const T&, std::string_view>,
+                      "Only support bool, integer, floating point and types "
+                      "convertible to std::string_view as field value type");
+        Append(ELEMENT_DQUOTE);
+        AppendEscapeString(value, ESCAPE_CHARS_FIELD_VALUE);
+        Append(ELEMENT_DQUOTE);
+    }
+}
+
+} // namespace opengemini::impl::enc
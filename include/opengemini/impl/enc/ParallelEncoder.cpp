@@ -0,0 +1,106 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/enc/ParallelEncoder.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+#include "opengemini/impl/comm/Join.hpp"
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+
+namespace opengemini::impl::enc {
+
+namespace detail {
+
+struct Slice {
+    std::size_t        begin;
+    std::size_t        end;
+    util::ChunkChain   chain;
+    std::exception_ptr error;
+};
+
+} // namespace detail
+
+OPENGEMINI_INLINE_SPECIFIER
+ParallelEncoder::ParallelEncoder(boost::asio::io_context& ctx,
+                                 std::size_t              threshold,
+                                 std::size_t              concurrency) :
+    ctx_(ctx),
+    threshold_(threshold),
+    concurrency_(concurrency)
+{ }
+
+OPENGEMINI_INLINE_SPECIFIER
+bool ParallelEncoder::Accept(PointSpan points) const noexcept
+{
+    return threshold_ != 0 && concurrency_ > 1 && points.size() >= threshold_;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+util::ChunkChain
+ParallelEncoder::Encode(PointSpan                  points,
+                        Precision                  unit,
+                        SeriesCache*               cache,
+                        boost::asio::yield_context yield) const
+{
+    util::ChunkChain content;
+    if (points.empty()) { return content; }
+
+    auto count = std::min(std::max<std::size_t>(concurrency_, 1),
+                          points.size());
+    auto step  = (points.size() + count - 1) / count;
+
+    std::vector<detail::Slice> slices;
+    slices.reserve(count);
+    for (std::size_t begin = 0; begin < points.size(); begin += step) {
+        slices.push_back({ begin, std::min(begin + step, points.size()) });
+    }
+
+    // The slices and points are referenced by the tasks, it is safe because
+    // the coroutine is not resumed until the last task finishes.
+    boost::asio::async_initiate<boost::asio::yield_context, void()>(
+        [this, points, unit, cache, &slices](auto handler) {
+            auto join = std::make_shared<Join<decltype(handler)>>(
+                ctx_.get_executor(),
+                std::move(handler),
+                slices.size());
+            for (auto& slice : slices) {
+                boost::asio::post(ctx_, [points, unit, cache, &slice, join] {
+                    try {
+                        LineProtocolEncoder encoder{ cache };
+                        encoder.SetTimeUnit(unit);
+                        for (auto idx = slice.begin; idx < slice.end; ++idx) {
+                            encoder.EncodeTo(points[idx], slice.chain);
+                        }
+                    }
+                    catch (...) {
+                        slice.error = std::current_exception();
+                    }
+                    join->Finish();
+                });
+            }
+        },
+        yield);
+
+    for (auto& slice : slices) {
+        if (slice.error) { std::rethrow_exception(slice.error); }
+        content.Append(std::move(slice.chain));
+    }
+    return content;
+}
+
+} // namespace opengemini::impl::enc
@@ -0,0 +1,68 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_ENC_PARALLELENCODER_HPP
+#define OPENGEMINI_IMPL_ENC_PARALLELENCODER_HPP
+
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/spawn.hpp>
+
+#include "opengemini/Point.hpp"
+#include "opengemini/PointSpan.hpp"
+#include "opengemini/impl/enc/SeriesCache.hpp"
+#include "opengemini/impl/util/ChunkChain.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::enc {
+
+// Encodes large batches of points into line protocol on the threads of an
+// io_context, so that one write does not keep all but one core idle.
+class ParallelEncoder {
+public:
+    // Batches with at least threshold points are encoded in parallel, a zero
+    // threshold disables parallel encoding.
+    ParallelEncoder(boost::asio::io_context& ctx,
+                    std::size_t              threshold,
+                    std::size_t              concurrency);
+
+    // Whether the points are worth being encoded in parallel.
+    bool Accept(PointSpan points) const noexcept;
+
+    // Splits the points into contiguous slices which are encoded
+    // concurrently, the calling coroutine is suspended until all of them are
+    // done. The encoded slices are joined in the order of points. If any
+    // point cannot be encoded, throws the exception of the first failed slice.
+    // Timestamps are written in units of unit, see
+    // LineProtocolEncoder::SetTimeUnit(). The cache is optional.
+    util::ChunkChain Encode(PointSpan                  points,
+                            Precision                  unit,
+                            SeriesCache*               cache,
+                            boost::asio::yield_context yield) const;
+
+private:
+    boost::asio::io_context& ctx_;
+    std::size_t              threshold_;
+    std::size_t              concurrency_;
+};
+
+} // namespace opengemini::impl::enc
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/enc/ParallelEncoder.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_ENC_PARALLELENCODER_HPP
@@ -0,0 +1,92 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/enc/SeriesCache.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace opengemini::impl::enc {
+
+OPENGEMINI_INLINE_SPECIFIER
+SeriesCache::SeriesCache(std::size_t capacity) :
+    shardCapacity_(std::max<std::size_t>((capacity + SHARDS - 1) / SHARDS, 1))
+{ }
+
+OPENGEMINI_INLINE_SPECIFIER
+bool SeriesCache::Lookup(std::string_view key, std::string& out)
+{
+    auto& shard = ShardOf(key);
+    {
+        std::lock_guard lock(shard.mutex);
+        if (auto iter = shard.index.find(key); iter != shard.index.end()) {
+            auto& slot      = shard.slots[iter->second];
+            slot.referenced = true;
+            out.append(slot.prefix);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SeriesCache::Insert(std::string_view key, std::string_view prefix)
+{
+    auto&           shard = ShardOf(key);
+    std::lock_guard lock(shard.mutex);
+    if (shard.index.count(key) != 0) { return; }
+
+    std::size_t victim{ shard.slots.size() };
+    if (shard.slots.size() < shardCapacity_) { shard.slots.emplace_back(); }
+    else {
+        // Gives every referenced entry a second chance.
+        for (;; shard.hand = (shard.hand + 1) % shard.slots.size()) {
+            auto& slot = shard.slots[shard.hand];
+            if (!slot.referenced) { break; }
+            slot.referenced = false;
+        }
+        victim     = shard.hand;
+        shard.hand = (shard.hand + 1) % shard.slots.size();
+        shard.index.erase(shard.slots[victim].key);
+    }
+
+    auto& slot = shard.slots[victim];
+    slot.key.assign(key);
+    slot.prefix.assign(prefix);
+    slot.referenced = false;
+    shard.index.emplace(slot.key, victim);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::uint64_t SeriesCache::Hits() const noexcept
+{
+    return hits_.load(std::memory_order_relaxed);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::uint64_t SeriesCache::Misses() const noexcept
+{
+    return misses_.load(std::memory_order_relaxed);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+SeriesCache::Shard& SeriesCache::ShardOf(std::string_view key)
+{
+    return shards_[std::hash<std::string_view>{}(key) % SHARDS];
+}
+
+} // namespace opengemini::impl::enc
@@ -0,0 +1,82 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_ENC_SERIESCACHE_HPP
+#define OPENGEMINI_IMPL_ENC_SERIESCACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::enc {
+
+// A bounded map from the identity of a series (measurement and tags) to its
+// escaped line protocol prefix "measurement,tag=value,...". Entries are
+// evicted with the CLOCK algorithm. Safe to be shared between threads, the
+// entries are spread over shards which are locked independently.
+class SeriesCache {
+public:
+    static constexpr std::size_t SHARDS{ 16 };
+
+public:
+    explicit SeriesCache(std::size_t capacity);
+
+    // Appends the prefix of the series to out and returns true if cached.
+    bool Lookup(std::string_view key, std::string& out);
+
+    // Caches the prefix of the series, evicting an entry if the shard is full.
+    void Insert(std::string_view key, std::string_view prefix);
+
+    std::uint64_t Hits() const noexcept;
+    std::uint64_t Misses() const noexcept;
+
+private:
+    struct Slot {
+        std::string key;
+        std::string prefix;
+        bool        referenced{ false };
+    };
+
+    struct Shard {
+        std::mutex                                        mutex;
+        // A deque keeps the keys viewed by index in place while growing.
+        std::deque<Slot>                                  slots;
+        std::unordered_map<std::string_view, std::size_t> index;
+        std::size_t                                       hand{ 0 };
+    };
+
+    Shard& ShardOf(std::string_view key);
+
+private:
+    std::size_t                shardCapacity_;
+    std::array<Shard, SHARDS>  shards_;
+    std::atomic<std::uint64_t> hits_{ 0 };
+    std::atomic<std::uint64_t> misses_{ 0 };
+};
+
+} // namespace opengemini::impl::enc
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/enc/SeriesCache.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_ENC_SERIESCACHE_HPP
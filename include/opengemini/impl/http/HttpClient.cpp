@@ -15,6 +15,7 @@
 #include "opengemini/impl/http/HttpClient.hpp"
 
 #include "opengemini/Exception.hpp"
+#include "opengemini/impl/http/ResponseReader.hpp"
 #include "opengemini/impl/util/Preprocessor.hpp"
 
 namespace opengemini::impl::http {
@@ -32,6 +33,32 @@ OPENGEMINI_INLINE_SPECIFIER
 Response HttpClient::SendRequest(const Endpoint&            endpoint,
                                  Request                    request,
                                  boost::asio::yield_context yield)
+{
+    return Send(endpoint, request, yield);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+Response HttpClient::SendStreamRequest(const Endpoint&            endpoint,
+                                       StreamRequest              request,
+                                       boost::asio::yield_context yield)
+{
+    return Send(endpoint, request, yield);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+Response HttpClient::SendConsumingRequest(const Endpoint&            endpoint,
+                                          Request                    request,
+                                          const BodyConsumer&        consume,
+                                          boost::asio::yield_context yield)
+{
+    return Send(endpoint, request, yield, &consume);
+}
+
+template<typename REQUEST>
+Response HttpClient::Send(const Endpoint&            endpoint,
+                          REQUEST&                   request,
+                          boost::asio::yield_context yield,
+                          const BodyConsumer*        consume)
 {
     namespace beast = boost::beast;
     namespace http  = boost::beast::http;
@@ -51,7 +78,13 @@ Response HttpClient::SendRequest(const Endpoint&            endpoint,
         }
 
         buffer.clear();
-        http::async_read(stream, buffer, response, yield[error]);
+        ReadResponse(stream,
+                     buffer,
+                     response,
+                     consume,
+                     readWriteTimeout_,
+                     yield,
+                     error);
         if (connection->ShouldRetry(error, "Read from stream failed.")) {
             continue;
         }
@@ -45,6 +45,21 @@ private:
                          Request                    request,
                          boost::asio::yield_context yield) override;
 
+    Response SendStreamRequest(const Endpoint&            endpoint,
+                               StreamRequest              request,
+                               boost::asio::yield_context yield) override;
+
+    Response SendConsumingRequest(const Endpoint&            endpoint,
+                                  Request                    request,
+                                  const BodyConsumer&        consume,
+                                  boost::asio::yield_context yield) override;
+
+    template<typename REQUEST>
+    Response Send(const Endpoint&            endpoint,
+                  REQUEST&                   request,
+                  boost::asio::yield_context yield,
+                  const BodyConsumer*        consume = nullptr);
+
 private:
     Pool pool_;
 };
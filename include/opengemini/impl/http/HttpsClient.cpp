@@ -18,6 +18,7 @@
 #include "opengemini/impl/http/HttpsClient.hpp"
 
 #include "opengemini/Exception.hpp"
+#include "opengemini/impl/http/ResponseReader.hpp"
 #include "opengemini/impl/util/Preprocessor.hpp"
 // clang-format on
 
@@ -59,6 +60,32 @@ OPENGEMINI_INLINE_SPECIFIER
 Response HttpsClient::SendRequest(const Endpoint&            endpoint,
                                   Request                    request,
                                   boost::asio::yield_context yield)
+{
+    return Send(endpoint, request, yield);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+Response HttpsClient::SendStreamRequest(const Endpoint&            endpoint,
+                                        StreamRequest              request,
+                                        boost::asio::yield_context yield)
+{
+    return Send(endpoint, request, yield);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+Response HttpsClient::SendConsumingRequest(const Endpoint&            endpoint,
+                                           Request                    request,
+                                           const BodyConsumer&        consume,
+                                           boost::asio::yield_context yield)
+{
+    return Send(endpoint, request, yield, &consume);
+}
+
+template<typename REQUEST>
+Response HttpsClient::Send(const Endpoint&            endpoint,
+                           REQUEST&                   request,
+                           boost::asio::yield_context yield,
+                           const BodyConsumer*        consume)
 {
     namespace asio  = boost::asio;
     namespace beast = boost::beast;
@@ -80,7 +107,13 @@ Response HttpsClient::SendRequest(const Endpoint&            endpoint,
         }
 
         buffer.clear();
-        http::async_read(tlsStream, buffer, response, yield[error]);
+        ReadResponse(tlsStream,
+                     buffer,
+                     response,
+                     consume,
+                     readWriteTimeout_,
+                     yield,
+                     error);
         if (connection->ShouldRetry(error, "Read from stream failed.")) {
             continue;
         }
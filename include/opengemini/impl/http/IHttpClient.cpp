@@ -18,6 +18,7 @@
 
 #include "opengemini/Version.hpp"
 #include "opengemini/impl/util/ErrorHandling.hpp"
+#include "opengemini/impl/util/Gzip.hpp"
 #include "opengemini/impl/util/Preprocessor.hpp"
 
 namespace opengemini::impl::http {
@@ -43,7 +44,7 @@ Response IHttpClient::Get(Endpoint                   endpoint,
                           boost::asio::yield_context yield)
 {
     auto request = BuildRequest(endpoint.host,
-                                std::move(target),
+                                target,
                                 {},
                                 boost::beast::http::verb::get);
     return SendRequest(std::move(endpoint), std::move(request), yield);
@@ -63,14 +64,30 @@ catch (...) {
     return {};
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+Response IHttpClient::Get(Endpoint                   endpoint,
+                          std::string                target,
+                          const BodyConsumer&        consume,
+                          boost::asio::yield_context yield)
+{
+    auto request = BuildRequest(endpoint.host,
+                                target,
+                                {},
+                                boost::beast::http::verb::get);
+    return SendConsumingRequest(std::move(endpoint),
+                                std::move(request),
+                                consume,
+                                yield);
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 Response IHttpClient::Post(Endpoint                   endpoint,
-                           std::string                target,
+                           std::string_view           target,
                            std::string                body,
                            boost::asio::yield_context yield)
 {
     auto request = BuildRequest(endpoint.host,
-                                std::move(target),
+                                target,
                                 std::move(body),
                                 boost::beast::http::verb::post);
     return SendRequest(std::move(endpoint), std::move(request), yield);
@@ -78,19 +95,52 @@ Response IHttpClient::Post(Endpoint                   endpoint,
 
 OPENGEMINI_INLINE_SPECIFIER
 Response IHttpClient::Post(Endpoint                   endpoint,
-                           std::string                target,
+                           std::string_view           target,
                            std::string                body,
                            boost::asio::yield_context yield,
                            Error&                     error)
 try {
     error.Clear();
-    return Post(std::move(endpoint), std::move(target), std::move(body), yield);
+    return Post(std::move(endpoint), target, std::move(body), yield);
 }
 catch (...) {
     util::ConvertError(error);
     return {};
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+Response IHttpClient::Post(Endpoint                    endpoint,
+                           std::string_view            target,
+                           std::shared_ptr<BodySource> body,
+                           boost::asio::yield_context  yield)
+{
+    StreamRequest request{ boost::beast::http::verb::post,
+                           { target.data(), target.size() },
+                           httpProtocolVersion_ };
+    SetHeaders(request, endpoint.host);
+    // The size of a streaming body is unknown in advance, so it is always
+    // compressed regardless of GzipConfig::minBodySize.
+    if (gzip_.has_value()) {
+        body = std::make_shared<GzipBodySource>(std::move(body), gzip_->level);
+        request.set(boost::beast::http::field::content_encoding, "gzip");
+    }
+    request.body() = std::move(body);
+    request.chunked(true);
+
+    return SendStreamRequest(std::move(endpoint), std::move(request), yield);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+Response IHttpClient::SendConsumingRequest(const Endpoint&            endpoint,
+                                           Request                    request,
+                                           const BodyConsumer&        consume,
+                                           boost::asio::yield_context yield)
+{
+    auto response = SendRequest(endpoint, std::move(request), yield);
+    if (response.result() == Status::ok) { consume(response.body()); }
+    return response;
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 std::unordered_map<std::string, std::string>&
 IHttpClient::DefaultHeaders() noexcept
@@ -98,24 +148,47 @@ IHttpClient::DefaultHeaders() noexcept
     return headers_;
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+void IHttpClient::EnableGzip(const GzipConfig& config)
+{
+    if (config.level < Z_NO_COMPRESSION || config.level > Z_BEST_COMPRESSION) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Gzip compression level must be in range [0, 9]");
+    }
+    gzip_.emplace(config);
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 Request IHttpClient::BuildRequest(std::string              host,
-                                  std::string              target,
+                                  std::string_view         target,
                                   std::string              body,
                                   boost::beast::http::verb method) const
 {
     Request request{ std::move(method),
-                     std::move(target),
+                     { target.data(), target.size() },
                      httpProtocolVersion_ };
-    request.body() = std::move(body);
-    for (const auto& header : headers_) {
-        request.set(header.first, header.second);
+    SetHeaders(request, std::move(host));
+    if (gzip_.has_value() && !body.empty() &&
+        body.size() >= gzip_->minBodySize) {
+        body = util::GzipCompress(body, gzip_->level);
+        request.set(boost::beast::http::field::content_encoding, "gzip");
     }
-    request.set(boost::beast::http::field::host, std::move(host));
-    request.set(boost::beast::http::field::user_agent, userAgent_);
+    request.body() = std::move(body);
     request.prepare_payload();
 
     return request;
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+void IHttpClient::SetHeaders(boost::beast::http::request_header<>& header,
+                             std::string                           host) const
+{
+    for (const auto& [name, value] : headers_) { header.set(name, value); }
+    if (gzip_.has_value()) {
+        header.set(boost::beast::http::field::accept_encoding, "gzip");
+    }
+    header.set(boost::beast::http::field::host, std::move(host));
+    header.set(boost::beast::http::field::user_agent, userAgent_);
+}
+
 } // namespace opengemini::impl::http
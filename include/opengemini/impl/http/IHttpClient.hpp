@@ -16,20 +16,32 @@
 #define OPENGEMINI_IMPL_HTTP_IHTTPCLIENT_HPP
 
 #include <chrono>
+#include <functional>
+#include <optional>
+#include <string_view>
 #include <unordered_map>
 
 #include <boost/asio/spawn.hpp>
 #include <boost/beast.hpp>
 
+#include "opengemini/ClientConfig.hpp"
 #include "opengemini/Endpoint.hpp"
 #include "opengemini/Error.hpp"
 #include "opengemini/impl/comm/TaskSlot.hpp"
+#include "opengemini/impl/http/InflatingStringBody.hpp"
+#include "opengemini/impl/http/StreamingBody.hpp"
 
 namespace opengemini::impl::http {
 
 using Status   = boost::beast::http::status;
 using Request  = boost::beast::http::request<boost::beast::http::string_body>;
-using Response = boost::beast::http::response<boost::beast::http::string_body>;
+using Response = boost::beast::http::response<InflatingStringBody>;
+
+using StreamRequest = boost::beast::http::request<StreamingBody>;
+
+// Consumes the body of a response piece by piece while it is being read, the
+// consumed bytes should be erased from the front of body.
+using BodyConsumer = std::function<void(std::string& body)>;
 
 class IHttpClient : public TaskSlot {
 public:
@@ -48,36 +60,65 @@ public:
                  boost::asio::yield_context yield,
                  Error&                     error);
 
+    // Hands the body of a successful response to consume while it is being
+    // read, the returned response holds what consume leaves behind.
+    Response Get(Endpoint                   endpoint,
+                 std::string                target,
+                 const BodyConsumer&        consume,
+                 boost::asio::yield_context yield);
+
     Response Post(Endpoint                   endpoint,
-                  std::string                target,
+                  std::string_view           target,
                   std::string                body,
                   boost::asio::yield_context yield);
 
     Response Post(Endpoint                   endpoint,
-                  std::string                target,
+                  std::string_view           target,
                   std::string                body,
                   boost::asio::yield_context yield,
                   Error&                     error);
 
+    Response Post(Endpoint                    endpoint,
+                  std::string_view            target,
+                  std::shared_ptr<BodySource> body,
+                  boost::asio::yield_context  yield);
+
     std::unordered_map<std::string, std::string>& DefaultHeaders() noexcept;
 
+    void EnableGzip(const GzipConfig& config);
+
 protected:
     virtual Response SendRequest(const Endpoint&            endpoint,
                                  Request                    request,
                                  boost::asio::yield_context yield) = 0;
 
+    virtual Response SendStreamRequest(const Endpoint&            endpoint,
+                                       StreamRequest              request,
+                                       boost::asio::yield_context yield) = 0;
+
+    // Reads the whole response before handing it to consume at once, the
+    // clients able to read the body piecewise should override it.
+    virtual Response SendConsumingRequest(const Endpoint&            endpoint,
+                                          Request                    request,
+                                          const BodyConsumer&        consume,
+                                          boost::asio::yield_context yield);
+
 private:
     Request BuildRequest(std::string              host,
-                         std::string              target,
+                         std::string_view         target,
                          std::string              body,
                          boost::beast::http::verb method) const;
 
+    void SetHeaders(boost::beast::http::request_header<>& header,
+                    std::string                           host) const;
+
 protected:
     const std::chrono::milliseconds connectTimeout_;
     const std::chrono::milliseconds readWriteTimeout_;
 
 private:
     std::unordered_map<std::string, std::string> headers_;
+    std::optional<GzipConfig>                    gzip_;
 
     const std::string     userAgent_;
     static constexpr auto httpProtocolVersion_{ 11 };
@@ -0,0 +1,118 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_HTTP_INFLATINGSTRINGBODY_HPP
+#define OPENGEMINI_IMPL_HTTP_INFLATINGSTRINGBODY_HPP
+
+#include <memory>
+#include <type_traits>
+
+#include <boost/beast.hpp>
+
+#include "opengemini/impl/util/Gzip.hpp"
+
+namespace opengemini::impl::http {
+
+// A string body which inflates the payload while it is being read, if the
+// message carries "Content-Encoding: gzip". The header fields describing the
+// encoded payload are removed once it has been inflated.
+struct InflatingStringBody : public boost::beast::http::string_body {
+    // Max bytes of the inflated payload kept in the body at once, the same as
+    // the limit Beast puts on the payload of a response by default. Bytes
+    // erased from the front of the body while reading are not counted.
+    static constexpr std::size_t bodyLimit{ 8 * 1024 * 1024 };
+
+    class reader {
+    public:
+        // The reader is constructed along with the parser, so the header is
+        // not available until init() is called.
+        template<bool isRequest, class Fields>
+        explicit reader(boost::beast::http::header<isRequest, Fields>& header,
+                        value_type&                                    body) :
+            body_(body)
+        {
+            if constexpr (std::is_same_v<Fields, boost::beast::http::fields>) {
+                fields_ = &header;
+            }
+        }
+
+        void init(const boost::optional<std::uint64_t>& length,
+                  boost::beast::error_code&             error)
+        {
+            using boost::beast::http::field;
+            if (fields_ &&
+                boost::beast::iequals((*fields_)[field::content_encoding],
+                                      "gzip")) {
+                inflater_ = std::make_unique<util::GzipInflater>();
+            }
+            else if (length) {
+                body_.reserve(*length);
+            }
+            error = {};
+        }
+
+        template<class ConstBufferSequence>
+        std::size_t put(const ConstBufferSequence& buffers,
+                        boost::beast::error_code&  error)
+        {
+            std::size_t size{ 0 };
+            for (auto buffer : boost::beast::buffers_range_ref(buffers)) {
+                auto data = static_cast<const char*>(buffer.data());
+                if (!inflater_) { body_.append(data, buffer.size()); }
+                else {
+                    received_ = true;
+                    if (!inflater_->Inflate(data,
+                                            buffer.size(),
+                                            body_,
+                                            bodyLimit)) {
+                        error = inflater_->Exceeded()
+                                    ? boost::beast::http::error::body_limit
+                                    : boost::system::errc::make_error_code(
+                                          boost::system::errc::bad_message);
+                        return size;
+                    }
+                }
+                size += buffer.size();
+            }
+
+            error = {};
+            return size;
+        }
+
+        void finish(boost::beast::error_code& error)
+        {
+            if (inflater_ && received_ && !inflater_->Done()) {
+                error = boost::system::errc::make_error_code(
+                    boost::system::errc::bad_message);
+                return;
+            }
+            if (inflater_) {
+                using boost::beast::http::field;
+                fields_->erase(field::content_encoding);
+                fields_->erase(field::content_length);
+            }
+            error = {};
+        }
+
+    private:
+        boost::beast::http::fields*         fields_{ nullptr };
+        value_type&                         body_;
+        std::unique_ptr<util::GzipInflater> inflater_;
+        bool                                received_{ false };
+    };
+};
+
+} // namespace opengemini::impl::http
+
+#endif // !OPENGEMINI_IMPL_HTTP_INFLATINGSTRINGBODY_HPP
@@ -0,0 +1,82 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_HTTP_RESPONSEREADER_HPP
+#define OPENGEMINI_IMPL_HTTP_RESPONSEREADER_HPP
+
+#include <chrono>
+
+#include <boost/asio/spawn.hpp>
+#include <boost/beast.hpp>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/http/IHttpClient.hpp"
+
+namespace opengemini::impl::http {
+
+// Reads a response from stream. If consume is not null and the status is
+// 200 OK, the body is handed to consume after every read and the next read
+// does not start until consume returns, so a slow consumer stops the socket
+// from being drained. Only the failures before the body starts to be consumed
+// are reported through error, which leaves the request free to be retried on
+// another connection; the later ones are thrown. The body of other statuses
+// is read whole, within the default limit of Beast.
+template<typename STREAM>
+void ReadResponse(STREAM&                    stream,
+                  boost::beast::flat_buffer& buffer,
+                  Response&                  response,
+                  const BodyConsumer*        consume,
+                  std::chrono::milliseconds  readWriteTimeout,
+                  boost::asio::yield_context yield,
+                  boost::beast::error_code&  error)
+{
+    namespace beast = boost::beast;
+    namespace http  = boost::beast::http;
+
+    if (!consume) {
+        http::async_read(stream, buffer, response, yield[error]);
+        return;
+    }
+
+    // The length is checked against the limit once the header is read, which
+    // is lifted until the status tells whether the body will be consumed.
+    http::response_parser<InflatingStringBody> parser;
+    parser.body_limit(boost::none);
+    http::async_read_header(stream, buffer, parser, yield[error]);
+    if (error) { return; }
+
+    if (parser.get().result() != http::status::ok) {
+        const std::uint64_t limit{ InflatingStringBody::bodyLimit };
+        if (parser.content_length().value_or(0) > limit) {
+            error = http::error::body_limit;
+            return;
+        }
+        parser.body_limit(limit);
+        http::async_read(stream, buffer, parser, yield[error]);
+        if (!error) { response = parser.release(); }
+        return;
+    }
+
+    while (!parser.is_done()) {
+        beast::get_lowest_layer(stream).expires_after(readWriteTimeout);
+        http::async_read_some(stream, buffer, parser, yield[error]);
+        if (error) { throw Exception(error, "Read from stream failed."); }
+        (*consume)(parser.get().body());
+    }
+    response = parser.release();
+}
+
+} // namespace opengemini::impl::http
+
+#endif // !OPENGEMINI_IMPL_HTTP_RESPONSEREADER_HPP
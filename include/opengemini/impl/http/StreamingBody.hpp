@@ -0,0 +1,166 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_HTTP_STREAMINGBODY_HPP
+#define OPENGEMINI_IMPL_HTTP_STREAMINGBODY_HPP
+
+#include <memory>
+#include <vector>
+
+#include <boost/beast.hpp>
+
+#include "opengemini/impl/util/ChunkChain.hpp"
+#include "opengemini/impl/util/Gzip.hpp"
+
+namespace opengemini::impl::http {
+
+// Produces a request body piece by piece while it is being sent.
+class BodySource {
+public:
+    virtual ~BodySource() = default;
+
+    // Restarts from the beginning of the body, called before every attempt
+    // of sending the request.
+    virtual void Rewind() = 0;
+
+    // Appends the next piece of the body to chain, returns false if the whole
+    // body has been produced.
+    virtual bool Produce(util::ChunkChain& chain) = 0;
+};
+
+// Replays a body which has been encoded into a chain beforehand.
+class ChainBodySource : public BodySource {
+public:
+    explicit ChainBodySource(util::ChunkChain chain) :
+        ChainBodySource(
+            std::make_shared<const util::ChunkChain>(std::move(chain)))
+    { }
+
+    // The chain can be shared with the sources of other requests.
+    explicit ChainBodySource(std::shared_ptr<const util::ChunkChain> chain) :
+        chain_(std::move(chain)),
+        buffers_(chain_->Buffers())
+    { }
+
+    void Rewind() override { next_ = 0; }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        if (next_ < buffers_.size()) {
+            // The chunks are kept alive by chain_ as long as this source.
+            auto& buffer = buffers_[next_++];
+            chain.Borrow(
+                { static_cast<const char*>(buffer.data()), buffer.size() });
+        }
+        return next_ < buffers_.size();
+    }
+
+private:
+    std::shared_ptr<const util::ChunkChain> chain_;
+    std::vector<boost::asio::const_buffer>  buffers_;
+    std::size_t                            next_{ 0 };
+};
+
+// Compresses the body produced by another source with gzip.
+class GzipBodySource : public BodySource {
+public:
+    GzipBodySource(std::shared_ptr<BodySource> source, int level) :
+        source_(std::move(source)),
+        deflater_(level)
+    { }
+
+    void Rewind() override
+    {
+        source_->Rewind();
+        deflater_.Reset();
+    }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        plain_.Clear();
+        auto more    = source_->Produce(plain_);
+        auto buffers = plain_.Buffers();
+        for (std::size_t idx = 0; idx < buffers.size(); ++idx) {
+            deflater_.Deflate(
+                { static_cast<const char*>(buffers[idx].data()),
+                  buffers[idx].size() },
+                chain,
+                !more && idx + 1 == buffers.size());
+        }
+        if (!more && buffers.empty()) { deflater_.Deflate({}, chain, true); }
+        return more;
+    }
+
+private:
+    std::shared_ptr<BodySource> source_;
+    util::GzipDeflater          deflater_;
+    util::ChunkChain            plain_;
+};
+
+// A body whose content is pulled from a BodySource while the message is being
+// serialized, at most FLUSH_SIZE bytes are held in memory at a time. The
+// message should be sent with chunked transfer encoding.
+struct StreamingBody {
+    static constexpr std::size_t FLUSH_SIZE{ 4 * util::ChunkPool::CHUNK_SIZE };
+
+    using value_type = std::shared_ptr<BodySource>;
+
+    class writer {
+    public:
+        using const_buffers_type = std::vector<boost::asio::const_buffer>;
+
+        template<bool isRequest, class Fields>
+        explicit writer(const boost::beast::http::header<isRequest, Fields>&,
+                        const value_type& body) :
+            source_(body)
+        { }
+
+        void init(boost::beast::error_code& error)
+        {
+            source_->Rewind();
+            more_ = true;
+            error = {};
+        }
+
+        boost::optional<std::pair<const_buffers_type, bool>>
+        get(boost::beast::error_code& error)
+        {
+            // The chunks handed out by the previous call have been sent.
+            chain_.Clear();
+            try {
+                while (more_ && chain_.Size() < FLUSH_SIZE) {
+                    more_ = source_->Produce(chain_);
+                }
+            }
+            catch (...) {
+                error = boost::system::errc::make_error_code(
+                    boost::system::errc::invalid_argument);
+                return boost::none;
+            }
+
+            error = {};
+            if (chain_.Empty()) { return boost::none; }
+            return std::make_pair(chain_.Buffers(), more_);
+        }
+
+    private:
+        const value_type& source_;
+        util::ChunkChain  chain_;
+        bool              more_{ true };
+    };
+};
+
+} // namespace opengemini::impl::http
+
+#endif // !OPENGEMINI_IMPL_HTTP_STREAMINGBODY_HPP
@@ -0,0 +1,43 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/lb/HashRing.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "opengemini/impl/util/Hash.hpp"
+
+namespace opengemini::impl::lb {
+
+OPENGEMINI_INLINE_SPECIFIER
+HashRing::HashRing(const std::vector<Endpoint>& endpoints)
+{
+    nodes_.reserve(endpoints.size() * VIRTUAL_NODES);
+    for (std::size_t idx = 0; idx < endpoints.size(); ++idx) {
+        // Positions depend on the address only, so that every client places
+        // a server at the same positions whatever the order of endpoints.
+        auto address = endpoints[idx].host + ':' +
+                       std::to_string(endpoints[idx].port) + '#';
+        for (std::size_t node = 0; node < VIRTUAL_NODES; ++node) {
+            auto hash = util::Fnv1a(std::to_string(node),
+                                    util::Fnv1a(address));
+            nodes_.emplace_back(util::Mix64(hash), idx);
+        }
+    }
+    std::sort(nodes_.begin(), nodes_.end());
+}
+
+} // namespace opengemini::impl::lb
@@ -0,0 +1,73 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_LB_HASHRING_HPP
+#define OPENGEMINI_IMPL_LB_HASHRING_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "opengemini/Endpoint.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::lb {
+
+// Maps keys onto servers with consistent hashing. Every server is placed at
+// VIRTUAL_NODES positions of a ring, and a key belongs to the first server
+// clockwise from its hash. If a server is skipped, only the keys which belong
+// to it move, to the servers following its positions.
+class HashRing {
+public:
+    static constexpr std::size_t VIRTUAL_NODES{ 128 };
+
+public:
+    explicit HashRing(const std::vector<Endpoint>& endpoints);
+
+    // Returns the index in endpoints of the first server clockwise from key
+    // for which accept(index) is true, or std::nullopt if there is none.
+    template<typename PREDICATE>
+    std::optional<std::size_t> Locate(std::uint64_t key,
+                                      PREDICATE&&   accept) const;
+
+private:
+    // Sorted positions on the ring and the index of the server at each one.
+    std::vector<std::pair<std::uint64_t, std::size_t>> nodes_;
+};
+
+template<typename PREDICATE>
+std::optional<std::size_t> HashRing::Locate(std::uint64_t key,
+                                            PREDICATE&&   accept) const
+{
+    auto first = std::lower_bound(nodes_.begin(),
+                                  nodes_.end(),
+                                  std::make_pair(key, std::size_t{ 0 }));
+    auto start = static_cast<std::size_t>(first - nodes_.begin());
+    for (std::size_t cnt = 0; cnt < nodes_.size(); ++cnt) {
+        auto index = nodes_[(start + cnt) % nodes_.size()].second;
+        if (accept(index)) { return index; }
+    }
+    return std::nullopt;
+}
+
+} // namespace opengemini::impl::lb
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/lb/HashRing.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_LB_HASHRING_HPP
@@ -33,6 +33,7 @@ LoadBalancer::LoadBalancer(PrivateConstructor,
     TaskSlot(ctx),
     http_(http),
     servers_(ConstructServers(endpoints)),
+    ring_(endpoints),
     timer_(ctx_, healthCheckPeriod),
     healthCheckPeriod_(healthCheckPeriod)
 { }
@@ -84,6 +85,18 @@ const Endpoint& LoadBalancer::PickAvailableServer()
     throw Exception(errc::ServerErrors::NoAvailableServer);
 }
 
+OPENGEMINI_INLINE_SPECIFIER
+const Endpoint& LoadBalancer::PickServerOf(std::uint64_t key) const
+{
+    auto idx = ring_.Locate(key, [this](std::size_t idx) {
+        return servers_[idx].good.load(std::memory_order_relaxed);
+    });
+    if (!idx.has_value()) {
+        throw Exception(errc::ServerErrors::NoAvailableServer);
+    }
+    return servers_[idx.value()].endpoint;
+}
+
 OPENGEMINI_INLINE_SPECIFIER
 void LoadBalancer::HealthCheck(boost::asio::yield_context yield)
 {
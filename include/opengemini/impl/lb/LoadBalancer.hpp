@@ -16,12 +16,14 @@
 #define OPENGEMINI_IMPL_LB_LOADBALANCER_HPP
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "opengemini/Endpoint.hpp"
 #include "opengemini/impl/comm/TaskSlot.hpp"
 #include "opengemini/impl/http/IHttpClient.hpp"
+#include "opengemini/impl/lb/HashRing.hpp"
 
 namespace opengemini::impl::lb {
 
@@ -56,6 +58,11 @@ public:
     const Endpoint& PickServer(std::size_t index) const;
     const Endpoint& PickAvailableServer();
 
+    // Picks the available server which key is mapped to by consistent
+    // hashing, the same key is mapped to the same server as long as it is
+    // available.
+    const Endpoint& PickServerOf(std::uint64_t key) const;
+
 private:
     struct Server {
         Endpoint          endpoint;
@@ -71,6 +78,7 @@ private:
 private:
     std::shared_ptr<http::IHttpClient> http_;
     std::vector<Server>                servers_;
+    HashRing                           ring_;
     std::atomic<std::size_t>           nextIdx_{ 0 };
 
     boost::asio::steady_timer timer_;
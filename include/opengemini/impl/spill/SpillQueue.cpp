@@ -0,0 +1,529 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "opengemini/impl/spill/SpillQueue.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <vector>
+
+#ifdef _WIN32
+#    include <fcntl.h>
+#    include <io.h>
+#else
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif // _WIN32
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/util/Preprocessor.hpp"
+
+namespace opengemini::impl::spill {
+
+namespace {
+
+constexpr std::size_t      HEADER_SIZE{ 8 };
+constexpr std::string_view SEGMENT_EXTENSION{ ".seg" };
+constexpr std::string_view SEGMENT_MAGIC{ "OGSQ" };
+constexpr std::uint32_t    SEGMENT_VERSION{ 1 };
+constexpr std::size_t      SEGMENT_HEADER_SIZE{ 8 };
+constexpr std::string_view CHECKPOINT{ "checkpoint" };
+constexpr std::string_view CHECKPOINT_TEMP{ "checkpoint.tmp" };
+
+inline void PutUint32(std::string& dest, std::uint32_t value)
+{
+    for (auto shift = 0; shift < 32; shift += 8) {
+        dest.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+inline std::uint32_t GetUint32(const char* src)
+{
+    std::uint32_t value{ 0 };
+    for (auto idx = 0; idx < 4; ++idx) {
+        auto byte = static_cast<unsigned char>(src[idx]);
+        value |= static_cast<std::uint32_t>(byte) << (idx * 8);
+    }
+    return value;
+}
+
+inline std::uint32_t Crc32(std::string_view data)
+{
+    return static_cast<std::uint32_t>(
+        ::crc32(0L,
+                reinterpret_cast<const Bytef*>(data.data()),
+                static_cast<uInt>(data.size())));
+}
+
+// Takes a length prefixed string from the front of data.
+inline bool TakeString(std::string_view& data, std::string_view& str)
+{
+    if (data.size() < 4) { return false; }
+    auto size = GetUint32(data.data());
+    data.remove_prefix(4);
+    if (data.size() < size) { return false; }
+    str = data.substr(0, size);
+    data.remove_prefix(size);
+    return true;
+}
+
+// Flushes the content of the file, or the entries of the directory, to the
+// storage device.
+inline bool SyncPath(const std::filesystem::path& path, bool directory)
+{
+#ifdef _WIN32
+    // Entries of a directory cannot be flushed on Windows.
+    if (directory) { return true; }
+    auto fd = ::_wopen(path.c_str(), _O_WRONLY | _O_BINARY);
+    if (fd < 0) { return false; }
+    auto synced = ::_commit(fd) == 0;
+    ::_close(fd);
+#else
+    auto fd = ::open(path.c_str(), directory ? O_RDONLY | O_DIRECTORY
+                                             : O_RDONLY);
+    if (fd < 0) { return false; }
+    auto synced = ::fsync(fd) == 0;
+    ::close(fd);
+#endif // _WIN32
+    return synced;
+}
+
+} // namespace
+
+OPENGEMINI_INLINE_SPECIFIER
+SpillQueue::SpillQueue(PrivateConstructor,
+                       boost::asio::io_context&  ctx,
+                       const SpillConfig&        config,
+                       Sender                    sender,
+                       std::chrono::milliseconds retryPeriod) :
+    TaskSlot(ctx),
+    config_(config),
+    directory_(config.directory),
+    sender_(std::move(sender)),
+    retryPeriod_(retryPeriod),
+    strand_(boost::asio::make_strand(ctx_)),
+    timer_(strand_)
+{
+    if (config_.directory.empty()) {
+        throw Exception(errc::LogicErrors::InvalidArgument,
+                        "Spill directory cannot be empty");
+    }
+    Recover();
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::Append(std::string_view database,
+                        std::string_view retentionPolicy,
+                        std::string_view body,
+                        Precision        precision)
+{
+    std::string payload;
+    payload.reserve(9 + database.size() + retentionPolicy.size() +
+                    body.size());
+    PutUint32(payload, static_cast<std::uint32_t>(database.size()));
+    payload.append(database);
+    PutUint32(payload, static_cast<std::uint32_t>(retentionPolicy.size()));
+    payload.append(retentionPolicy);
+    payload.push_back(static_cast<char>(precision));
+    payload.append(body);
+    if (payload.size() > UINT32_MAX) {
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        "Write is too large to be spilled");
+    }
+
+    std::string record;
+    record.reserve(HEADER_SIZE + payload.size());
+    PutUint32(record, static_cast<std::uint32_t>(payload.size()));
+    PutUint32(record, Crc32(payload));
+    record.append(payload);
+
+    std::lock_guard lock(mutex_);
+    auto            rotated =
+        !writer_.is_open() ||
+        (segments_.back().size > SEGMENT_HEADER_SIZE &&
+         segments_.back().size + record.size() > config_.segmentBytes);
+    auto required = record.size() + (rotated ? SEGMENT_HEADER_SIZE : 0);
+    if (diskBytes_ + required > config_.maxDiskBytes) {
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        fmt::format("Disk usage of {} would exceed {} bytes",
+                                    directory_.string(),
+                                    config_.maxDiskBytes));
+    }
+    if (rotated) { OpenWriterLocked(); }
+
+    auto& tail = segments_.back();
+    writer_.write(record.data(), static_cast<std::streamsize>(record.size()));
+    writer_.flush();
+    if (!writer_) {
+        // Discards the partial record, the following writes go to a new
+        // segment.
+        writer_.close();
+        std::error_code ignored;
+        std::filesystem::resize_file(SegmentPath(tail.id), tail.size, ignored);
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        fmt::format("Write to {} failed",
+                                    SegmentPath(tail.id).string()));
+    }
+    tail.size += record.size();
+    diskBytes_ += record.size();
+
+    dirty_ = true;
+    if (std::chrono::steady_clock::now() - syncedAt_ >= config_.syncInterval &&
+        !SyncLocked()) {
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        fmt::format("Sync {} failed",
+                                    SegmentPath(tail.id).string()));
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::optional<SpillQueue::Entry> SpillQueue::Front()
+{
+    std::lock_guard lock(mutex_);
+    frontSize_   = 0;
+    auto skipped = false;
+    for (; !segments_.empty(); skipped = true) {
+        auto& front = segments_.front();
+        readOffset_ = std::max(readOffset_, SEGMENT_HEADER_SIZE);
+        if (!reader_.is_open() || readerId_ != front.id) {
+            reader_.close();
+            reader_.clear();
+            reader_.open(SegmentPath(front.id), std::ios::binary);
+            readerId_ = front.id;
+        }
+
+        while (readOffset_ < front.size) {
+            Entry entry;
+            auto  intact = false;
+            auto  size   = ReadRecord(reader_, readOffset_, &entry, intact);
+            if (size == 0) { break; }
+            if (intact) {
+                if (skipped) { SaveCheckpointLocked(); }
+                frontSize_ = entry.size = size;
+                return entry;
+            }
+            // The length of a corrupted record is still trusted as it lands
+            // on the next intact record in most cases.
+            readOffset_ += size;
+            skipped = true;
+        }
+        // All records are replayed, or the rest cannot be framed.
+        RemoveFrontLocked();
+    }
+    if (skipped) { SaveCheckpointLocked(); }
+    return std::nullopt;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::Pop()
+{
+    std::lock_guard lock(mutex_);
+    if (frontSize_ == 0) { return; }
+
+    readOffset_ += std::exchange(frontSize_, 0);
+    if (readOffset_ >= segments_.front().size) { RemoveFrontLocked(); }
+    SaveCheckpointLocked();
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::size_t SpillQueue::DiskBytes() const
+{
+    std::lock_guard lock(mutex_);
+    return diskBytes_;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::StartReplay()
+{
+    boost::asio::spawn(
+        strand_,
+        [self = shared_from_this(), this](auto yield) { Replay(yield); },
+        boost::asio::detached);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::StopReplay()
+{
+    stopped_ = true;
+    boost::asio::post(strand_,
+                      [self = shared_from_this(), this] { timer_.cancel(); });
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::Recover()
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+    if (error) {
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        fmt::format("Create directory {} failed: {}",
+                                    directory_.string(),
+                                    error.message()));
+    }
+
+    std::uint64_t checkpointId{ 0 };
+    std::size_t   checkpointOffset{ 0 };
+    if (std::ifstream file(directory_ / CHECKPOINT);
+        !(file >> checkpointId >> checkpointOffset)) {
+        checkpointId = checkpointOffset = 0;
+    }
+
+    std::vector<std::uint64_t> ids;
+    for (std::filesystem::directory_iterator it(directory_, error), end;
+         !error && it != end;
+         it.increment(error)) {
+        auto& path = it->path();
+        if (path.extension() != SEGMENT_EXTENSION) { continue; }
+
+        auto          stem = path.stem().string();
+        std::uint64_t id{ 0 };
+        auto          last = stem.data() + stem.size();
+        if (auto [ptr, ec] = std::from_chars(stem.data(), last, id);
+            ec == std::errc{} && ptr == last) {
+            ids.push_back(id);
+        }
+    }
+    if (error) {
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        fmt::format("List directory {} failed: {}",
+                                    directory_.string(),
+                                    error.message()));
+    }
+    std::sort(ids.begin(), ids.end());
+
+    nextId_ = checkpointId;
+    for (auto id : ids) {
+        nextId_ = std::max(nextId_, id + 1);
+        if (id < checkpointId) {
+            // Replayed before the process exited.
+            std::filesystem::remove(SegmentPath(id), error);
+            continue;
+        }
+
+        auto          path = SegmentPath(id);
+        std::ifstream file(path, std::ios::binary);
+        char          header[SEGMENT_HEADER_SIZE];
+        if (!file.read(header, SEGMENT_HEADER_SIZE)) {
+            // Created right before the process exited, no record is in it.
+            file.close();
+            std::filesystem::remove(path, error);
+            continue;
+        }
+        if (std::string_view(header, SEGMENT_MAGIC.size()) != SEGMENT_MAGIC ||
+            GetUint32(header + SEGMENT_MAGIC.size()) != SEGMENT_VERSION) {
+            throw Exception(
+                errc::RuntimeErrors::SpillFailed,
+                fmt::format("{} is written in an unsupported format, replay "
+                            "or remove it before using the directory",
+                            path.string()));
+        }
+
+        auto size = std::filesystem::file_size(path, error);
+        segments_.push_back({ id, error ? 0 : static_cast<std::size_t>(size) });
+    }
+    if (segments_.empty()) { return; }
+
+    if (segments_.front().id == checkpointId) {
+        readOffset_ = std::min(checkpointOffset, segments_.front().size);
+    }
+
+    // The process may have exited in the middle of appending a record.
+    auto&         back = segments_.back();
+    std::ifstream file(SegmentPath(back.id), std::ios::binary);
+    std::size_t   offset{ SEGMENT_HEADER_SIZE };
+    auto          intact = false;
+    while (auto size = ReadRecord(file, offset, nullptr, intact)) {
+        offset += size;
+    }
+    if (offset != back.size) {
+        std::filesystem::resize_file(SegmentPath(back.id), offset, error);
+        back.size = offset;
+    }
+    if (segments_.size() == 1) { readOffset_ = std::min(readOffset_, offset); }
+
+    for (auto& segment : segments_) { diskBytes_ += segment.size; }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::Replay(boost::asio::yield_context yield)
+{
+    while (!stopped_) {
+        timer_.expires_after(retryPeriod_);
+        timer_.async_wait(yield);
+
+        // Appends stopped before the sync interval elapsed are synced here,
+        // a failure is left to the next period.
+        {
+            std::lock_guard lock(mutex_);
+            if (std::chrono::steady_clock::now() - syncedAt_ >=
+                config_.syncInterval) {
+                SyncLocked();
+            }
+        }
+
+        while (!stopped_) {
+            auto entry = Front();
+            if (!entry) { break; }
+
+            auto sent = false;
+            try {
+                sent = sender_(*entry, yield);
+            }
+            catch (const std::exception&) {
+            }
+            if (!sent) { break; }
+            Pop();
+
+            if (auto rate = config_.replayBytesPerSecond; rate != 0) {
+                std::chrono::duration<double> interval(
+                    static_cast<double>(entry->size) /
+                    static_cast<double>(rate));
+                timer_.expires_after(std::chrono::duration_cast<
+                                     boost::asio::steady_timer::duration>(
+                    interval));
+                timer_.async_wait(yield);
+            }
+        }
+    }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::filesystem::path SpillQueue::SegmentPath(std::uint64_t id) const
+{
+    return directory_ / fmt::format("{:020}{}", id, SEGMENT_EXTENSION);
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::OpenWriterLocked()
+{
+    // The records of the previous segment are not appended any more.
+    SyncLocked();
+    writer_.close();
+    writer_.clear();
+
+    auto id = nextId_;
+    writer_.open(SegmentPath(id),
+                 std::ios::binary | std::ios::out | std::ios::trunc);
+
+    std::string header(SEGMENT_MAGIC);
+    PutUint32(header, SEGMENT_VERSION);
+    writer_.write(header.data(), static_cast<std::streamsize>(header.size()));
+    writer_.flush();
+    if (!writer_ || !SyncPath(SegmentPath(id), false) ||
+        !SyncPath(directory_, true)) {
+        writer_.close();
+        std::error_code ignored;
+        std::filesystem::remove(SegmentPath(id), ignored);
+        throw Exception(errc::RuntimeErrors::SpillFailed,
+                        fmt::format("Open {} failed",
+                                    SegmentPath(id).string()));
+    }
+    ++nextId_;
+    segments_.push_back({ id, SEGMENT_HEADER_SIZE });
+    diskBytes_ += SEGMENT_HEADER_SIZE;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+bool SpillQueue::SyncLocked()
+{
+    if (!dirty_) { return true; }
+    if (!SyncPath(SegmentPath(segments_.back().id), false)) { return false; }
+    dirty_    = false;
+    syncedAt_ = std::chrono::steady_clock::now();
+    return true;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::RemoveFrontLocked()
+{
+    auto front = segments_.front();
+    if (segments_.size() == 1) { writer_.close(); }
+    if (readerId_ == front.id) { reader_.close(); }
+
+    if (segments_.size() == 1) { dirty_ = false; }
+
+    std::error_code ignored;
+    std::filesystem::remove(SegmentPath(front.id), ignored);
+    diskBytes_ -= front.size;
+    segments_.pop_front();
+    readOffset_ = 0;
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+void SpillQueue::SaveCheckpointLocked()
+{
+    auto id = segments_.empty() ? nextId_ : segments_.front().id;
+    {
+        std::ofstream file(directory_ / CHECKPOINT_TEMP, std::ios::trunc);
+        file << id << ' ' << readOffset_ << '\n';
+        file.flush();
+        if (!file) { return; }
+    }
+
+    // Replaying again from an outdated checkpoint only duplicates some writes,
+    // which the server overwrites with the same values. Syncing before the
+    // rename keeps a crash from leaving an empty checkpoint behind.
+    std::error_code error;
+    if (!SyncPath(directory_ / CHECKPOINT_TEMP, false)) { return; }
+    std::filesystem::rename(directory_ / CHECKPOINT_TEMP,
+                            directory_ / CHECKPOINT,
+                            error);
+    if (!error) { SyncPath(directory_, true); }
+}
+
+OPENGEMINI_INLINE_SPECIFIER
+std::size_t SpillQueue::ReadRecord(std::istream& stream,
+                                   std::size_t   offset,
+                                   Entry*        entry,
+                                   bool&         intact)
+{
+    intact = false;
+    stream.clear();
+    if (!stream.seekg(0, std::ios::end)) { return 0; }
+    auto end = static_cast<std::size_t>(stream.tellg());
+    if (offset + HEADER_SIZE > end || !stream.seekg(offset)) { return 0; }
+
+    char header[HEADER_SIZE];
+    if (!stream.read(header, HEADER_SIZE)) { return 0; }
+    auto length = GetUint32(header);
+    if (offset + HEADER_SIZE + length > end) { return 0; }
+
+    std::string payload(length, '\0');
+    if (!stream.read(payload.data(), length)) { return 0; }
+    if (Crc32(payload) != GetUint32(header + 4)) {
+        return HEADER_SIZE + length;
+    }
+
+    std::string_view data(payload), database, retentionPolicy;
+    if (!TakeString(data, database) || !TakeString(data, retentionPolicy) ||
+        data.empty()) {
+        return HEADER_SIZE + length;
+    }
+    auto precision = static_cast<Precision>(data.front());
+    data.remove_prefix(1);
+    if (entry) {
+        entry->database        = database;
+        entry->retentionPolicy = retentionPolicy;
+        entry->body            = data;
+        entry->precision       = precision;
+    }
+    intact = true;
+    return HEADER_SIZE + length;
+}
+
+} // namespace opengemini::impl::spill
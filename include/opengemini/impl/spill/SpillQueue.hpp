@@ -0,0 +1,174 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_SPILL_SPILLQUEUE_HPP
+#define OPENGEMINI_IMPL_SPILL_SPILLQUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <boost/asio/spawn.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+
+#include "opengemini/ClientConfig.hpp"
+#include "opengemini/Precision.hpp"
+#include "opengemini/impl/comm/TaskSlot.hpp"
+
+namespace opengemini::impl::spill {
+
+// A FIFO queue of encoded writes kept in segment files of a directory, which
+// survives restarts of the process. A segment starts with a magic and the
+// version of its format, then every record is framed with its length and
+// CRC32, so a record torn by a crash is discarded on recovery and a corrupted
+// one is skipped. Segments are synced every SpillConfig::syncInterval. The
+// position of the first record not replayed yet is saved in a checkpoint
+// file, which is synced and replaced atomically with a rename after every
+// Pop().
+class SpillQueue :
+    public TaskSlot,
+    public std::enable_shared_from_this<SpillQueue> {
+private:
+    struct PrivateConstructor {
+        constexpr PrivateConstructor() = default;
+    };
+
+public:
+    struct Entry {
+        std::string database;
+        std::string retentionPolicy;
+        std::string body;
+
+        // Unit of the timestamps in body.
+        Precision precision{ Precision::Nanosecond };
+
+        // Bytes of the record in the segment file.
+        std::size_t size{ 0 };
+    };
+
+    // Sends a spilled write, returns false if it should be retried later.
+    using Sender = std::function<bool(const Entry&             entry,
+                                      boost::asio::yield_context yield)>;
+
+public:
+    template<typename... ARGS>
+    static std::shared_ptr<SpillQueue> Construct(ARGS&&... args)
+    {
+        return std::make_shared<SpillQueue>(PrivateConstructor{},
+                                            std::forward<ARGS>(args)...);
+    }
+
+    SpillQueue(PrivateConstructor,
+               boost::asio::io_context&  ctx,
+               const SpillConfig&        config,
+               Sender                    sender,
+               std::chrono::milliseconds retryPeriod = std::chrono::seconds(1));
+
+    ~SpillQueue() = default;
+
+    // Appends a write to the end of the queue, throws if it exceeds the disk
+    // usage limit or could not be written.
+    void Append(std::string_view database,
+                std::string_view retentionPolicy,
+                std::string_view body,
+                Precision        precision = Precision::Nanosecond);
+
+    // Returns the first write of the queue if any, without removing it.
+    std::optional<Entry> Front();
+
+    // Removes the write returned by the last Front().
+    void Pop();
+
+    // Bytes of the segment files in the directory.
+    std::size_t DiskBytes() const;
+
+    // Replays the queued writes with the sender every retry period until the
+    // queue is empty or the sender fails.
+    void StartReplay();
+    void StopReplay();
+
+private:
+    struct Segment {
+        std::uint64_t id;
+        std::size_t   size;
+    };
+
+    using Strand = boost::asio::strand<boost::asio::io_context::executor_type>;
+
+private:
+    void Recover();
+    void Replay(boost::asio::yield_context yield);
+
+    std::filesystem::path SegmentPath(std::uint64_t id) const;
+
+    void OpenWriterLocked();
+    void RemoveFrontLocked();
+    void SaveCheckpointLocked();
+
+    // Syncs the records appended to the last segment since the last call,
+    // returns false if they could not be synced.
+    bool SyncLocked();
+
+    // Returns the size of the record at offset of the stream, or 0 if it
+    // cannot be framed. Its content is stored to entry and intact is set only
+    // if the record is not corrupted.
+    static std::size_t ReadRecord(std::istream& stream,
+                                  std::size_t   offset,
+                                  Entry*        entry,
+                                  bool&         intact);
+
+private:
+    const SpillConfig               config_;
+    const std::filesystem::path     directory_;
+    const Sender                    sender_;
+    const std::chrono::milliseconds retryPeriod_;
+
+    std::deque<Segment> segments_;
+    std::uint64_t       nextId_{ 0 };
+    std::size_t         readOffset_{ 0 };
+    std::size_t         frontSize_{ 0 };
+    std::size_t         diskBytes_{ 0 };
+    std::ofstream       writer_;
+    std::ifstream       reader_;
+    std::uint64_t       readerId_{ 0 };
+    bool                dirty_{ false };
+    mutable std::mutex  mutex_;
+
+    std::chrono::steady_clock::time_point syncedAt_;
+
+    // Replay() and the cancel of its timer run on the strand, as the timer is
+    // not safe to be used from different threads.
+    Strand                    strand_;
+    boost::asio::steady_timer timer_;
+    std::atomic<bool>         stopped_{ false };
+};
+
+} // namespace opengemini::impl::spill
+
+#ifndef OPENGEMINI_SEPARATE_COMPILATION
+#    include "opengemini/impl/spill/SpillQueue.cpp"
+#endif // !OPENGEMINI_SEPARATE_COMPILATION
+
+#endif // !OPENGEMINI_IMPL_SPILL_SPILLQUEUE_HPP
@@ -0,0 +1,219 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_UTIL_CHUNKCHAIN_HPP
+#define OPENGEMINI_IMPL_UTIL_CHUNKCHAIN_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+
+namespace opengemini::util {
+
+// A process wide free list of fixed-size chunks, so that the memory of sent
+// bodies can be reused by the following ones instead of going back and forth
+// to the allocator.
+class ChunkPool {
+public:
+    static constexpr std::size_t CHUNK_SIZE{ 64 * 1024 };
+    static constexpr std::size_t MAX_IDLE_CHUNKS{ 64 };
+
+    using ChunkPtr = std::unique_ptr<char[]>;
+
+public:
+    static ChunkPool& Instance()
+    {
+        static ChunkPool pool;
+        return pool;
+    }
+
+    ChunkPtr Acquire()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            if (!idle_.empty()) {
+                auto chunk = std::move(idle_.back());
+                idle_.pop_back();
+                return chunk;
+            }
+        }
+        // Not value-initialized, the bytes are always written before read.
+        return ChunkPtr(new char[CHUNK_SIZE]);
+    }
+
+    void Release(ChunkPtr chunk)
+    {
+        std::lock_guard lock(mutex_);
+        if (idle_.size() < MAX_IDLE_CHUNKS) {
+            idle_.push_back(std::move(chunk));
+        }
+    }
+
+private:
+    ChunkPool() = default;
+
+private:
+    std::vector<ChunkPtr> idle_;
+    std::mutex            mutex_;
+};
+
+// A growable byte sequence made of pooled chunks. Growing it never moves the
+// bytes already written, and the content can be handed to vectored I/O as a
+// buffer sequence without being concatenated.
+class ChunkChain {
+public:
+    ChunkChain() = default;
+    ~ChunkChain() { Clear(); }
+
+    ChunkChain(ChunkChain&& other) noexcept :
+        chunks_(std::move(other.chunks_)),
+        size_(std::exchange(other.size_, 0))
+    {
+        other.chunks_.clear();
+    }
+
+    // Gives the chunks of this chain back to the pool before taking over the
+    // ones of other, leaving other empty.
+    ChunkChain& operator=(ChunkChain&& other) noexcept
+    {
+        if (this != &other) {
+            Clear();
+            chunks_ = std::move(other.chunks_);
+            size_   = std::exchange(other.size_, 0);
+            other.chunks_.clear();
+        }
+        return *this;
+    }
+
+    void Append(std::string_view data)
+    {
+        while (!data.empty()) {
+            auto [dest, capacity] = Prepare();
+            auto size             = std::min(capacity, data.size());
+            std::memcpy(dest, data.data(), size);
+            Commit(size);
+            data.remove_prefix(size);
+        }
+    }
+
+    // Appends data without copying it, the data must outlive the chain or
+    // the next Clear().
+    void Borrow(std::string_view data)
+    {
+        if (data.empty()) { return; }
+        chunks_.push_back({ nullptr, data.size(), data.data() });
+        size_ += data.size();
+    }
+
+    // Moves the chunks of other to the end of this chain without copying,
+    // leaving other empty.
+    void Append(ChunkChain&& other)
+    {
+        chunks_.insert(chunks_.end(),
+                       std::make_move_iterator(other.chunks_.begin()),
+                       std::make_move_iterator(other.chunks_.end()));
+        size_ += other.size_;
+        other.chunks_.clear();
+        other.size_ = 0;
+    }
+
+    // Copies the borrowed data into pooled chunks, so that the chain no longer
+    // depends on the lifetime of the memory it borrowed from.
+    void Own()
+    {
+        auto chunks = std::move(chunks_);
+        chunks_.clear();
+        size_ = 0;
+        for (auto& chunk : chunks) {
+            if (chunk.borrowed) { Append({ chunk.borrowed, chunk.size }); }
+            else {
+                size_ += chunk.size;
+                chunks_.push_back(std::move(chunk));
+            }
+        }
+    }
+
+    // Returns the writable space at the end of the chain, which is never
+    // empty. Call Commit() with the number of bytes actually written.
+    std::pair<char*, std::size_t> Prepare()
+    {
+        if (chunks_.empty() || chunks_.back().borrowed ||
+            chunks_.back().size == ChunkPool::CHUNK_SIZE) {
+            chunks_.push_back({ ChunkPool::Instance().Acquire(), 0 });
+        }
+        auto& tail = chunks_.back();
+        return { tail.data.get() + tail.size,
+                 ChunkPool::CHUNK_SIZE - tail.size };
+    }
+
+    void Commit(std::size_t size)
+    {
+        chunks_.back().size += size;
+        size_ += size;
+    }
+
+    std::size_t Size() const noexcept { return size_; }
+
+    bool Empty() const noexcept { return size_ == 0; }
+
+    // Gives the chunks back to the pool.
+    void Clear()
+    {
+        for (auto& chunk : chunks_) {
+            if (chunk.data) {
+                ChunkPool::Instance().Release(std::move(chunk.data));
+            }
+        }
+        chunks_.clear();
+        size_ = 0;
+    }
+
+    std::vector<boost::asio::const_buffer> Buffers() const
+    {
+        std::vector<boost::asio::const_buffer> buffers;
+        buffers.reserve(chunks_.size());
+        for (auto& chunk : chunks_) {
+            if (chunk.size != 0) {
+                buffers.emplace_back(
+                    chunk.borrowed ? chunk.borrowed : chunk.data.get(),
+                    chunk.size);
+            }
+        }
+        return buffers;
+    }
+
+private:
+    struct Chunk {
+        ChunkPool::ChunkPtr data;
+        std::size_t         size;
+
+        // Points to the data not owned by the chain if not null.
+        const char* borrowed{ nullptr };
+    };
+
+private:
+    std::vector<Chunk> chunks_;
+    std::size_t        size_{ 0 };
+};
+
+} // namespace opengemini::util
+
+#endif // !OPENGEMINI_IMPL_UTIL_CHUNKCHAIN_HPP
@@ -0,0 +1,153 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_UTIL_FINDFIRSTOF_HPP
+#define OPENGEMINI_IMPL_UTIL_FINDFIRSTOF_HPP
+
+#include <cassert>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define OPENGEMINI_FIND_FIRST_OF_SSE2
+#    include <emmintrin.h>
+#    if defined(__GNUC__) || defined(__clang__)
+#        define OPENGEMINI_FIND_FIRST_OF_AVX2
+#        include <immintrin.h>
+#    endif
+#endif
+
+namespace opengemini::util {
+
+namespace detail {
+
+// Sets with more chars than this are not supported by the vectorized scans.
+constexpr std::size_t FIND_FIRST_OF_MAX_SET_SIZE{ 4 };
+
+using FindFirstOfFunction = std::size_t (*)(std::string_view data,
+                                            std::string_view set);
+
+inline std::size_t FindFirstOfScalar(std::string_view data,
+                                     std::string_view set,
+                                     std::size_t      pos = 0)
+{
+    for (; pos < data.size(); ++pos) {
+        if (set.find(data[pos]) != set.npos) { return pos; }
+    }
+    return data.size();
+}
+
+inline int CountTrailingZeros(unsigned int mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int count{ 0 };
+    for (; (mask & 1) == 0; mask >>= 1) { ++count; }
+    return count;
+#endif
+}
+
+#ifdef OPENGEMINI_FIND_FIRST_OF_SSE2
+
+inline std::size_t FindFirstOfSse2(std::string_view data, std::string_view set)
+{
+    assert(set.size() <= FIND_FIRST_OF_MAX_SET_SIZE);
+
+    __m128i     needles[FIND_FIRST_OF_MAX_SET_SIZE];
+    std::size_t count{ 0 };
+    for (auto ch : set) { needles[count++] = _mm_set1_epi8(ch); }
+
+    std::size_t pos{ 0 };
+    for (; pos + sizeof(__m128i) <= data.size(); pos += sizeof(__m128i)) {
+        auto block = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data.data() + pos));
+        auto matched = _mm_setzero_si128();
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            matched =
+                _mm_or_si128(matched, _mm_cmpeq_epi8(block, needles[idx]));
+        }
+        if (auto mask = static_cast<unsigned>(_mm_movemask_epi8(matched))) {
+            return pos + CountTrailingZeros(mask);
+        }
+    }
+    return FindFirstOfScalar(data, set, pos);
+}
+
+#endif // OPENGEMINI_FIND_FIRST_OF_SSE2
+
+#ifdef OPENGEMINI_FIND_FIRST_OF_AVX2
+
+__attribute__((target("avx2"))) inline std::size_t
+FindFirstOfAvx2(std::string_view data, std::string_view set)
+{
+    assert(set.size() <= FIND_FIRST_OF_MAX_SET_SIZE);
+
+    __m256i     needles[FIND_FIRST_OF_MAX_SET_SIZE];
+    std::size_t count{ 0 };
+    for (auto ch : set) { needles[count++] = _mm256_set1_epi8(ch); }
+
+    std::size_t pos{ 0 };
+    for (; pos + sizeof(__m256i) <= data.size(); pos += sizeof(__m256i)) {
+        auto block = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data.data() + pos));
+        auto matched = _mm256_setzero_si256();
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            matched = _mm256_or_si256(matched,
+                                      _mm256_cmpeq_epi8(block, needles[idx]));
+        }
+        if (auto mask = static_cast<unsigned>(_mm256_movemask_epi8(matched))) {
+            return pos + CountTrailingZeros(mask);
+        }
+    }
+    return FindFirstOfSse2(data.substr(pos), set) + pos;
+}
+
+#endif // OPENGEMINI_FIND_FIRST_OF_AVX2
+
+inline std::size_t FindFirstOfScalarEntry(std::string_view data,
+                                          std::string_view set)
+{
+    return FindFirstOfScalar(data, set);
+}
+
+inline FindFirstOfFunction SelectFindFirstOf()
+{
+#ifdef OPENGEMINI_FIND_FIRST_OF_AVX2
+    if (__builtin_cpu_supports("avx2")) { return FindFirstOfAvx2; }
+#endif
+#ifdef OPENGEMINI_FIND_FIRST_OF_SSE2
+    return FindFirstOfSse2;
+#else
+    return FindFirstOfScalarEntry;
+#endif
+}
+
+} // namespace detail
+
+// Returns the position of the first char in data which equals to any of the
+// chars in set, or data.size() if there is no such char. The implementation
+// is chosen at runtime according to the instruction sets supported by the CPU.
+inline std::size_t FindFirstOf(std::string_view data, std::string_view set)
+{
+    if (set.size() > detail::FIND_FIRST_OF_MAX_SET_SIZE) {
+        return detail::FindFirstOfScalar(data, set);
+    }
+
+    static const auto function = detail::SelectFindFirstOf();
+    return function(data, set);
+}
+
+} // namespace opengemini::util
+
+#endif // !OPENGEMINI_IMPL_UTIL_FINDFIRSTOF_HPP
@@ -0,0 +1,179 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENGEMINI_IMPL_UTIL_GZIP_HPP
+#define OPENGEMINI_IMPL_UTIL_GZIP_HPP
+
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/util/ChunkChain.hpp"
+
+namespace opengemini::util {
+
+inline std::string GzipCompress(std::string_view data, int level)
+{
+    z_stream stream{};
+    // windowBits + 16 tells zlib to write a gzip header and trailer.
+    auto ret = deflateInit2(&stream,
+                            level,
+                            Z_DEFLATED,
+                            MAX_WBITS + 16,
+                            8,
+                            Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        throw Exception(errc::RuntimeErrors::Unexpected,
+                        "Initialize gzip compressor failed");
+    }
+
+    std::string result(deflateBound(&stream, data.size()), '\0');
+    stream.next_in =
+        reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in  = static_cast<uInt>(data.size());
+    stream.next_out  = reinterpret_cast<Bytef*>(result.data());
+    stream.avail_out = static_cast<uInt>(result.size());
+
+    ret = deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
+    deflateEnd(&stream);
+    if (ret != Z_STREAM_END) {
+        throw Exception(errc::RuntimeErrors::Unexpected,
+                        "Compress data with gzip failed");
+    }
+
+    return result;
+}
+
+class GzipDeflater {
+public:
+    explicit GzipDeflater(int level)
+    {
+        auto ret = deflateInit2(&stream_,
+                                level,
+                                Z_DEFLATED,
+                                MAX_WBITS + 16,
+                                8,
+                                Z_DEFAULT_STRATEGY);
+        if (ret != Z_OK) {
+            throw Exception(errc::RuntimeErrors::Unexpected,
+                            "Initialize gzip compressor failed");
+        }
+    }
+
+    ~GzipDeflater() { deflateEnd(&stream_); }
+
+    // Compresses data into output, the gzip trailer is written once finish is
+    // true, after that Reset() must be called before compressing new data.
+    void Deflate(std::string_view data, ChunkChain& output, bool finish)
+    {
+        stream_.next_in =
+            reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream_.avail_in = static_cast<uInt>(data.size());
+
+        auto flush = finish ? Z_FINISH : Z_NO_FLUSH;
+        for (;;) {
+            auto [dest, capacity] = output.Prepare();
+            stream_.next_out      = reinterpret_cast<Bytef*>(dest);
+            stream_.avail_out     = static_cast<uInt>(capacity);
+
+            auto ret = deflate(&stream_, flush);
+            output.Commit(capacity - stream_.avail_out);
+            if (ret == Z_STREAM_END) { break; }
+            if (ret != Z_OK && ret != Z_BUF_ERROR) {
+                throw Exception(errc::RuntimeErrors::Unexpected,
+                                "Compress data with gzip failed");
+            }
+            if (!finish && stream_.avail_in == 0 && stream_.avail_out != 0) {
+                break;
+            }
+        }
+    }
+
+    void Reset() { deflateReset(&stream_); }
+
+private:
+    GzipDeflater(const GzipDeflater&)            = delete;
+    GzipDeflater& operator=(const GzipDeflater&) = delete;
+
+private:
+    z_stream stream_{};
+};
+
+class GzipInflater {
+public:
+    GzipInflater()
+    {
+        // windowBits + 32 enables automatic gzip/zlib header detection.
+        if (inflateInit2(&stream_, MAX_WBITS + 32) != Z_OK) {
+            throw Exception(errc::RuntimeErrors::Unexpected,
+                            "Initialize gzip decompressor failed");
+        }
+    }
+
+    ~GzipInflater() { inflateEnd(&stream_); }
+
+    // Decompresses data and appends it to output, fails if the data is
+    // corrupted or output would grow beyond limit bytes.
+    bool Inflate(const void*  data,
+                 std::size_t  size,
+                 std::string& output,
+                 std::size_t  limit = std::numeric_limits<std::size_t>::max())
+    {
+        stream_.next_in  = static_cast<Bytef*>(const_cast<void*>(data));
+        stream_.avail_in = static_cast<uInt>(size);
+
+        while (!done_) {
+            Bytef buffer[16 * 1024];
+            stream_.next_out  = buffer;
+            stream_.avail_out = sizeof(buffer);
+
+            auto ret = inflate(&stream_, Z_NO_FLUSH);
+            if (ret == Z_BUF_ERROR) { break; }
+            if (ret != Z_OK && ret != Z_STREAM_END) { return false; }
+
+            auto inflated = sizeof(buffer) - stream_.avail_out;
+            if (inflated > limit || output.size() > limit - inflated) {
+                exceeded_ = true;
+                return false;
+            }
+            output.append(reinterpret_cast<const char*>(buffer), inflated);
+            done_ = (ret == Z_STREAM_END);
+            if (stream_.avail_in == 0 && stream_.avail_out != 0) { break; }
+        }
+
+        return true;
+    }
+
+    bool Done() const noexcept { return done_; }
+
+    // Whether the last failed Inflate() was caused by the limit.
+    bool Exceeded() const noexcept { return exceeded_; }
+
+private:
+    GzipInflater(const GzipInflater&)            = delete;
+    GzipInflater& operator=(const GzipInflater&) = delete;
+
+private:
+    z_stream stream_{};
+    bool     done_{ false };
+    bool     exceeded_{ false };
+};
+
+} // namespace opengemini::util
+
+#endif // !OPENGEMINI_IMPL_UTIL_GZIP_HPP
@@ -0,0 +1,52 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_UTIL_HASH_HPP
+#define OPENGEMINI_IMPL_UTIL_HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace opengemini::util {
+
+constexpr std::uint64_t FNV1A_OFFSET_BASIS{ 14695981039346656037ULL };
+
+// Continues the 64-bit FNV-1a hash of hash with data. Unlike std::hash, the
+// result is the same on every platform and in every process.
+constexpr std::uint64_t Fnv1a(std::string_view data,
+                              std::uint64_t    hash = FNV1A_OFFSET_BASIS)
+{
+    for (auto ch : data) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Spreads the bits of a hash over the whole range, the finalizer of
+// SplitMix64, which FNV-1a of short data does not do well on its own.
+constexpr std::uint64_t Mix64(std::uint64_t hash)
+{
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+} // namespace opengemini::util
+
+#endif // !OPENGEMINI_IMPL_UTIL_HASH_HPP
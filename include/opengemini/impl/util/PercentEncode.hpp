@@ -0,0 +1,55 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef OPENGEMINI_IMPL_UTIL_PERCENTENCODE_HPP
+#define OPENGEMINI_IMPL_UTIL_PERCENTENCODE_HPP
+
+#include <string>
+#include <string_view>
+
+namespace opengemini::util {
+
+// Appends data to out with every char other than the unreserved ones of RFC
+// 3986 replaced by its percent-encoded form, so that the result can be used as
+// the value of a query parameter.
+inline void PercentEncodeTo(std::string_view data, std::string& out)
+{
+    constexpr std::string_view digits{ "0123456789ABCDEF" };
+
+    for (auto ch : data) {
+        if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+            (ch >= '0' && ch <= '9') || ch == '-' || ch == '.' || ch == '_' ||
+            ch == '~') {
+            out.push_back(ch);
+            continue;
+        }
+        auto byte = static_cast<unsigned char>(ch);
+        out.push_back('%');
+        out.push_back(digits[byte >> 4]);
+        out.push_back(digits[byte & 0xF]);
+    }
+}
+
+inline std::string PercentEncode(std::string_view data)
+{
+    std::string out;
+    out.reserve(data.size());
+    PercentEncodeTo(data, out);
+    return out;
+}
+
+} // namespace opengemini::util
+
+#endif // !OPENGEMINI_IMPL_UTIL_PERCENTENCODE_HPP
@@ -18,6 +18,8 @@
 #include <tuple>
 #include <type_traits>
 
+#include "opengemini/CompletionToken.hpp"
+
 namespace opengemini::util {
 
 template<typename FUNCTION, typename SIGNATURE>
@@ -41,6 +43,29 @@ struct HandlerExtraArgs<void(std::exception_ptr, ARGS...)> {
 template<typename SIGNATURE>
 using HandlerExtraArgs_t = typename HandlerExtraArgs<SIGNATURE>::type;
 
+namespace detail {
+
+template<typename COMPLETION_TOKEN>
+struct IsWaitingToken : std::is_same<COMPLETION_TOKEN, token::Sync> { };
+
+#if __cplusplus >= 202002L
+template<typename EXECUTOR>
+struct IsWaitingToken<boost::asio::use_awaitable_t<EXECUTOR>> :
+    std::true_type { };
+#endif // (__cplusplus >= 202002L)
+
+} // namespace detail
+
+// Whether the caller is suspended until the operation initiated with the
+// completion token completes, so that the arguments can be borrowed from it.
+template<typename COMPLETION_TOKEN>
+struct IsWaitingToken :
+    detail::IsWaitingToken<std::decay_t<COMPLETION_TOKEN>> { };
+
+template<typename COMPLETION_TOKEN>
+inline constexpr auto IsWaitingToken_v =
+    IsWaitingToken<COMPLETION_TOKEN>::value;
+
 } // namespace opengemini::util
 
 #endif // !OPENGEMINI_IMPL_UTIL_TYPETRAITS_HPP
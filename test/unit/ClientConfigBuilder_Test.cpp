@@ -27,11 +27,18 @@ TEST(ClientConfigBuilderTest, BasicUsage)
             .AppendAddress({ "127.0.0.1", 8086 })
             .AppendAddresses({ { "localhost", 1234 }, { "dummy-host", 18086 } })
             .EnableGzip(true)
+            .GzipConfig(9, 512)
             .AuthCredential("dummyuser", "dummypass")
             .ReadWriteTimeout(3500ms)
             .ConnectTimeout(20s)
             .BatchConfig(1min, 10000)
             .ConcurrencyHint(12)
+            .ParallelEncodeThreshold(100000)
+            .SeriesCacheCapacity(200000)
+            .BackpressureConfig(8, 64, 1 << 20, OverflowPolicy::DropOldest)
+            .SpillConfig("/var/spool/opengemini", 1 << 30, 1 << 24, 1 << 20)
+            .WriteRouting(WriteRouting::BySeries)
+            .ReplicationConfig({ { { "replica", 8086 } } }, AckPolicy::Quorum)
             .Finalize();
 
     auto endpointPred = [](const Endpoint&  endpoint,
@@ -44,7 +51,11 @@ TEST(ClientConfigBuilderTest, BasicUsage)
     EXPECT_PRED3(endpointPred, conf.addresses[2], "dummy-host", 18086);
 
     EXPECT_EQ(conf.gzipEnabled, true);
+    EXPECT_EQ(conf.gzipConfig->level, 9);
+    EXPECT_EQ(conf.gzipConfig->minBodySize, 512);
     EXPECT_EQ(conf.concurrencyHint, 12);
+    EXPECT_EQ(conf.parallelEncodeThreshold, 100000);
+    EXPECT_EQ(conf.seriesCacheCapacity, 200000);
 
     const auto& [username, password] =
         std::get<AuthCredential>(conf.authConfig.value());
@@ -56,6 +67,25 @@ TEST(ClientConfigBuilderTest, BasicUsage)
 
     EXPECT_EQ(conf.batchConfig->batchSize, 10000);
     EXPECT_EQ(conf.batchConfig->batchInterval, 1min);
+    EXPECT_FALSE(conf.batchConfig->coalescePoints);
+
+    EXPECT_EQ(conf.backpressureConfig->maxInflightRequests, 8);
+    EXPECT_EQ(conf.backpressureConfig->maxQueuedRequests, 64);
+    EXPECT_EQ(conf.backpressureConfig->maxInflightBytes, 1 << 20);
+    EXPECT_EQ(conf.backpressureConfig->overflowPolicy,
+              OverflowPolicy::DropOldest);
+
+    EXPECT_EQ(conf.spillConfig->directory, "/var/spool/opengemini");
+    EXPECT_EQ(conf.writeRouting, WriteRouting::BySeries);
+    ASSERT_EQ(conf.replicationConfig->replicas.size(), 1);
+    EXPECT_PRED3(endpointPred,
+                 conf.replicationConfig->replicas[0][0],
+                 "replica",
+                 8086);
+    EXPECT_EQ(conf.replicationConfig->ackPolicy, AckPolicy::Quorum);
+    EXPECT_EQ(conf.spillConfig->maxDiskBytes, 1 << 30);
+    EXPECT_EQ(conf.spillConfig->segmentBytes, 1 << 24);
+    EXPECT_EQ(conf.spillConfig->replayBytesPerSecond, 1 << 20);
 }
 
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
@@ -0,0 +1,120 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/FlatMap.hpp"
+#include "test/Random.hpp"
+
+namespace opengemini::test {
+
+using Map = FlatMap<std::string, int>;
+
+TEST(FlatMapTest, ConstructFromInitializerList)
+{
+    Map map{ { "b", 2 }, { "a", 1 }, { "c", 3 }, { "a", 4 } };
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.begin()->first, "a");
+    EXPECT_EQ(map.begin()->second, 1);
+    EXPECT_EQ(map.rbegin()->first, "c");
+    EXPECT_EQ(map, (Map{ { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+}
+
+TEST(FlatMapTest, EmplaceKeepsExistingValue)
+{
+    Map map;
+    EXPECT_TRUE(map.emplace("a", 1).second);
+    EXPECT_FALSE(map.emplace("a", 2).second);
+    EXPECT_EQ(map.at("a"), 1);
+
+    EXPECT_FALSE(map.insert_or_assign("a", 3).second);
+    EXPECT_EQ(map.at("a"), 3);
+
+    map["b"] += 5;
+    EXPECT_EQ(map.at(std::string_view{ "b" }), 5);
+    EXPECT_THROW(map.at("c"), std::out_of_range);
+}
+
+TEST(FlatMapTest, FindAndErase)
+{
+    Map map{ { "a", 1 }, { "b", 2 } };
+
+    EXPECT_EQ(map.count("a"), 1);
+    EXPECT_EQ(map.count("c"), 0);
+    EXPECT_EQ(map.find("c"), map.end());
+
+    EXPECT_EQ(map.erase("a"), 1);
+    EXPECT_EQ(map.erase("a"), 0);
+    auto next = map.erase(map.find("b"));
+    EXPECT_EQ(next, map.end());
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(FlatMapTest, IterateWithConstKeys)
+{
+    Map map{ { "a", 1 }, { "b", 2 } };
+    static_assert(std::is_same_v<decltype(*map.begin()),
+                                 std::pair<const std::string, int>&>);
+    static_assert(std::is_same_v<decltype(*map.cbegin()),
+                                 const std::pair<const std::string, int>&>);
+
+    for (auto& [key, value] : map) { value *= 10; }
+
+    Map::const_iterator iter = map.begin();
+    EXPECT_EQ(iter, map.cbegin());
+    EXPECT_EQ(map.end() - iter, 2);
+    EXPECT_EQ(iter[1].second, 20);
+    EXPECT_EQ(std::prev(map.end())->first, "b");
+    EXPECT_EQ(map, (Map{ { "a", 10 }, { "b", 20 } }));
+}
+
+TEST(FlatMapTest, RebuildAroundInsertedAndErased)
+{
+    Map map{ { "a", 1 }, { "c", 3 } };
+    EXPECT_TRUE(map.emplace("b", map.at("c")).second);
+    EXPECT_EQ(map.erase(map.begin())->first, "b");
+
+    Map copy{ { "d", 4 } };
+    copy = map;
+    EXPECT_EQ(copy, (Map{ { "b", 3 }, { "c", 3 } }));
+}
+
+TEST(FlatMapTest, IterateInSameOrderAsStdMap)
+{
+    Map                        flat;
+    std::map<std::string, int> expect;
+    for (auto idx = 0; idx < 1000; ++idx) {
+        auto key = GenerateRandomString(GenerateRandomNumber(0, 8));
+        flat.emplace(key, idx);
+        expect.emplace(key, idx);
+    }
+
+    ASSERT_EQ(flat.size(), expect.size());
+    EXPECT_TRUE(std::equal(flat.begin(),
+                           flat.end(),
+                           expect.begin(),
+                           [](const auto& lhs, const auto& rhs) {
+                               return lhs.first == rhs.first &&
+                                      lhs.second == rhs.second;
+                           }));
+}
+
+} // namespace opengemini::test
@@ -0,0 +1,80 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/Schema.hpp"
+
+namespace opengemini::test {
+
+struct Sample {
+    std::string tag;
+    int64_t     field;
+    Point::Time time;
+};
+
+} // namespace opengemini::test
+
+namespace opengemini {
+
+template<>
+struct Schema<test::Sample> {
+    static constexpr auto measurement = schema::Measurement("sample");
+    static constexpr auto tags =
+        std::make_tuple(schema::Tag("tag", &test::Sample::tag));
+    static constexpr auto fields =
+        std::make_tuple(schema::Field("field", &test::Sample::field));
+    static constexpr auto time      = &test::Sample::time;
+    static constexpr auto precision = Precision::Second;
+};
+
+} // namespace opengemini
+
+namespace opengemini::test {
+
+TEST(SchemaTest, EscapeKeysAtCompileTime)
+{
+    constexpr auto measurement = schema::Measurement(R"(m 0,1=2\)");
+    static_assert(measurement.escaped.View() == R"(m\ 0\,1=2\)");
+
+    constexpr auto tag = schema::Tag("t 0,1=2", &Sample::tag);
+    static_assert(tag.escaped.View() == R"(,t\ 0\,1\=2=)");
+
+    constexpr auto field = schema::Field("f", &Sample::field);
+    static_assert(field.escaped.View() == ",f=");
+
+    constexpr auto escapeAll = schema::Field(",,,", &Sample::field);
+    static_assert(escapeAll.escaped.View() == R"(,\,\,\,=)");
+}
+
+TEST(SchemaTest, DetectSchema)
+{
+    static_assert(HasSchema_v<Sample>);
+    static_assert(!HasSchema_v<Point>);
+    static_assert(!HasSchema_v<int>);
+}
+
+TEST(SchemaTest, DefaultPrecision)
+{
+    struct WithoutPrecision { };
+    static_assert(schema::detail::PrecisionOf<WithoutPrecision>::value ==
+                  Precision::Nanosecond);
+    static_assert(schema::detail::PrecisionOf<Schema<Sample>>::value ==
+                  Precision::Second);
+}
+
+} // namespace opengemini::test
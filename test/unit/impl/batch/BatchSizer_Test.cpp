@@ -0,0 +1,95 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/batch/BatchSizer.hpp"
+#include "test/ExpectThrowAs.hpp"
+
+using namespace std::chrono_literals;
+
+namespace opengemini::test {
+
+using namespace opengemini::impl;
+
+TEST(BatchSizerTest, KeepConfiguredPolicyIfNotAdaptive)
+{
+    batch::BatchSizer sizer({ 100ms, 1000 });
+    sizer.OnWritten(1000, 10ms, false);
+    sizer.OnWritten(1000, 10s, true);
+    EXPECT_EQ(sizer.BatchSize(), 1000);
+    EXPECT_EQ(sizer.BatchInterval(), 100ms);
+
+    auto stats = sizer.Stats();
+    EXPECT_EQ(stats.flushes, 2);
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_GT(stats.latency, 10ms);
+}
+
+TEST(BatchSizerTest, ConstructWithInvalidBounds)
+{
+    EXPECT_THROW_AS(
+        batch::BatchSizer({ 100ms, 1000, false, false, { { 0, 10, 1s } } }),
+        errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(
+        batch::BatchSizer({ 100ms, 1000, false, false, { { 20, 10, 1s } } }),
+        errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(
+        batch::BatchSizer({ 100ms, 1000, false, false, { { 1, 10, 0s } } }),
+        errc::LogicErrors::InvalidArgument);
+}
+
+TEST(BatchSizerTest, IncreaseAdditivelyWithinTargetLatency)
+{
+    batch::BatchSizer sizer(
+        { 100ms, 1000, false, false, { { 100, 1700, 1s } } });
+    EXPECT_EQ(sizer.BatchSize(), 1000);
+
+    sizer.OnWritten(1000, 10ms, false);
+    EXPECT_EQ(sizer.BatchSize(), 1100);
+
+    // Batches flushed by timer say nothing about larger ones.
+    sizer.OnWritten(10, 10ms, false);
+    EXPECT_EQ(sizer.BatchSize(), 1100);
+
+    for (auto idx = 0; idx < 10; ++idx) { sizer.OnWritten(2000, 10ms, false); }
+    EXPECT_EQ(sizer.BatchSize(), 1700);
+    EXPECT_EQ(sizer.BatchInterval(), 100ms);
+}
+
+TEST(BatchSizerTest, DecreaseMultiplicativelyOnSlowOrFailedWrites)
+{
+    batch::BatchSizer sizer(
+        { 100ms, 1000, false, false, { { 100, 2000, 1s } } });
+
+    sizer.OnWritten(1000, 2s, false);
+    EXPECT_EQ(sizer.BatchSize(), 500);
+    EXPECT_EQ(sizer.BatchInterval(), 50ms);
+
+    // Taken before the decrease above.
+    sizer.OnWritten(1000, 2s, false);
+    EXPECT_EQ(sizer.BatchSize(), 500);
+
+    sizer.OnWritten(500, 10ms, true);
+    EXPECT_EQ(sizer.BatchSize(), 250);
+
+    for (auto idx = 0; idx < 10; ++idx) { sizer.OnWritten(1, 10ms, true); }
+    EXPECT_EQ(sizer.BatchSize(), 100);
+    EXPECT_EQ(sizer.BatchInterval(), 10ms);
+    EXPECT_EQ(sizer.Stats().failures, 11);
+}
+
+} // namespace opengemini::test
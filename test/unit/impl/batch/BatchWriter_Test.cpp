@@ -0,0 +1,386 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/batch/BatchWriter.hpp"
+#include "test/ExpectThrowAs.hpp"
+#include "test/TestFixtureWithContext.hpp"
+
+using namespace std::chrono_literals;
+
+namespace opengemini::test {
+
+using namespace opengemini::impl;
+
+class BatchWriterTestFixture : public TestFixtureWithContext {
+protected:
+    struct Flushed {
+        std::string                database;
+        std::string                retentionPolicy;
+        std::vector<Point>         points;
+        batch::BatchWriter::Target target;
+    };
+
+    std::shared_ptr<batch::BatchWriter>
+    ConstructWriter(BatchConfig config, std::exception_ptr result = nullptr)
+    {
+        return batch::BatchWriter::Construct(
+            ctx_(),
+            config,
+            [this, result](batch::BatchWriter::Target  target,
+                           std::vector<Point>          points,
+                           batch::BatchWriter::Handler handler) {
+                {
+                    std::lock_guard lock(mutex_);
+                    flushed_.push_back({ target->database,
+                                         target->retentionPolicy,
+                                         std::move(points),
+                                         target });
+                }
+                boost::asio::post(ctx_(), [handler, result] {
+                    handler(result);
+                });
+            });
+    }
+
+    static batch::BatchWriter::Target Target(std::string database,
+                                             std::string retentionPolicy)
+    {
+        return std::make_shared<const cli::WriteTarget>(
+            std::move(database),
+            std::move(retentionPolicy));
+    }
+
+    static auto MakeHandler(std::promise<void>& promise)
+    {
+        return [&promise](std::exception_ptr error) {
+            if (error) { promise.set_exception(error); }
+            else {
+                promise.set_value();
+            }
+        };
+    }
+
+    std::vector<Flushed> Flushes()
+    {
+        std::lock_guard lock(mutex_);
+        return flushed_;
+    }
+
+protected:
+    std::vector<Flushed> flushed_;
+    std::mutex           mutex_;
+};
+
+TEST_F(BatchWriterTestFixture, ConstructWithInvalidConfig)
+{
+    EXPECT_THROW_AS(ConstructWriter({ 0ms, 10 }),
+                    errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(ConstructWriter({ 10ms, 0 }),
+                    errc::LogicErrors::InvalidArgument);
+}
+
+TEST_F(BatchWriterTestFixture, FlushWhenBatchSizeReached)
+{
+    auto writer = ConstructWriter({ 1h, 3 });
+
+    std::promise<void> p1, p2, p3;
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 2 } } },
+                   MakeHandler(p2));
+    EXPECT_TRUE(Flushes().empty());
+
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 3 } } },
+                   MakeHandler(p3));
+    EXPECT_NO_THROW(p1.get_future().get());
+    EXPECT_NO_THROW(p2.get_future().get());
+    EXPECT_NO_THROW(p3.get_future().get());
+
+    auto flushes = Flushes();
+    ASSERT_EQ(flushes.size(), 1);
+    EXPECT_EQ(flushes[0].database, "db");
+    EXPECT_EQ(flushes[0].retentionPolicy, "rp");
+    EXPECT_EQ(flushes[0].points.size(), 3);
+}
+
+TEST_F(BatchWriterTestFixture, FlushWhenIntervalExpired)
+{
+    auto writer = ConstructWriter({ 50ms, 100 });
+
+    std::promise<void> p1, p2;
+    writer->Append(Target("db", ""),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Append(Target("db", ""),
+                   std::vector<Point>{ { "m", { { "a", 2 } } },
+                                       { "m", { { "a", 3 } } } },
+                   MakeHandler(p2));
+
+    auto f1 = p1.get_future();
+    EXPECT_EQ(f1.wait_for(5s), std::future_status::ready);
+    EXPECT_NO_THROW(f1.get());
+    EXPECT_NO_THROW(p2.get_future().get());
+
+    auto flushes = Flushes();
+    ASSERT_EQ(flushes.size(), 1);
+    EXPECT_EQ(flushes[0].points.size(), 3);
+}
+
+TEST_F(BatchWriterTestFixture, MergeBatchesAppendedByManyThreads)
+{
+    constexpr std::size_t threads{ 8 };
+    constexpr std::size_t writes{ 500 };
+
+    auto writer = ConstructWriter({ 10ms, 64 });
+
+    std::atomic<std::size_t> completed{ 0 };
+    std::vector<std::thread> producers;
+    for (std::size_t idx = 0; idx < threads; ++idx) {
+        producers.emplace_back([&writer, &completed, idx] {
+            for (std::size_t seq = 0; seq < writes; ++seq) {
+                writer->Append(
+                    Target("db", "rp"),
+                    Point{ "m",
+                           { { "seq", static_cast<int64_t>(seq) } },
+                           {},
+                           { { "thread", std::to_string(idx) } } },
+                    [&completed](std::exception_ptr error) {
+                        if (!error) { ++completed; }
+                    });
+            }
+        });
+    }
+    for (auto& producer : producers) { producer.join(); }
+    writer->Stop();
+
+    for (auto idx = 0; idx < 100 && completed < threads * writes; ++idx) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(completed, threads * writes);
+
+    // Every thread's points stay in the order they were appended.
+    std::map<std::string, int64_t> last;
+    std::size_t                    points{ 0 };
+    for (auto& flushed : Flushes()) {
+        points += flushed.points.size();
+        for (auto& point : flushed.points) {
+            auto  seq  = std::get<int64_t>(point.fields.at("seq"));
+            auto& prev = last.try_emplace(point.tags.at("thread"), -1)
+                             .first->second;
+            EXPECT_EQ(seq, prev + 1);
+            prev = seq;
+        }
+    }
+    EXPECT_EQ(points, threads * writes);
+}
+
+TEST_F(BatchWriterTestFixture, SeparateBatchesByDatabaseAndRetentionPolicy)
+{
+    auto writer = ConstructWriter({ 1h, 2 });
+
+    std::promise<void> p1, p2, p3, p4;
+    writer->Append(Target("db1", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Append(Target("db2", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p2));
+    writer->Append(Target("db1", ""),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p3));
+    EXPECT_TRUE(Flushes().empty());
+
+    writer->Append(Target("db1", "rp"),
+                   Point{ "m", { { "a", 2 } } },
+                   MakeHandler(p4));
+    EXPECT_NO_THROW(p1.get_future().get());
+    EXPECT_NO_THROW(p4.get_future().get());
+
+    auto flushes = Flushes();
+    ASSERT_EQ(flushes.size(), 1);
+    EXPECT_EQ(flushes[0].database, "db1");
+    EXPECT_EQ(flushes[0].retentionPolicy, "rp");
+
+    writer->Stop();
+    EXPECT_NO_THROW(p2.get_future().get());
+    EXPECT_NO_THROW(p3.get_future().get());
+    EXPECT_EQ(Flushes().size(), 3);
+}
+
+TEST_F(BatchWriterTestFixture, FlushToTargetOfFirstWrite)
+{
+    auto writer = ConstructWriter({ 1h, 2 });
+    auto first  = Target("db", "rp");
+
+    std::promise<void> p1, p2;
+    writer->Append(first, Point{ "m", { { "a", 1 } } }, MakeHandler(p1));
+    // Built apart but with the same names, so it shares the batch.
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 2 } } },
+                   MakeHandler(p2));
+    EXPECT_NO_THROW(p1.get_future().get());
+    EXPECT_NO_THROW(p2.get_future().get());
+
+    auto flushes = Flushes();
+    ASSERT_EQ(flushes.size(), 1);
+    EXPECT_EQ(flushes[0].target, first);
+    EXPECT_EQ(flushes[0].points.size(), 2);
+}
+
+TEST_F(BatchWriterTestFixture, CoalescePointsBeforeFlushing)
+{
+    auto writer = ConstructWriter({ 1h, 3, true });
+
+    std::promise<void> p1, p2, p3;
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 1 } }, Point::Time{ 1s } },
+                   MakeHandler(p1));
+    writer->Append(Target("db", "rp"),
+                   Point{ "n", { { "a", 2 } }, Point::Time{ 1s } },
+                   MakeHandler(p2));
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "b", 3 } }, Point::Time{ 1s } },
+                   MakeHandler(p3));
+    EXPECT_NO_THROW(p1.get_future().get());
+    EXPECT_NO_THROW(p2.get_future().get());
+    EXPECT_NO_THROW(p3.get_future().get());
+
+    auto flushes = Flushes();
+    ASSERT_EQ(flushes.size(), 1);
+    ASSERT_EQ(flushes[0].points.size(), 2);
+    EXPECT_EQ(flushes[0].points[0].measurement, "m");
+    EXPECT_EQ(flushes[0].points[0].fields.size(), 2);
+    EXPECT_EQ(flushes[0].points[1].measurement, "n");
+}
+
+TEST_F(BatchWriterTestFixture, FlushFailureReportedToEveryWriter)
+{
+    auto writer = ConstructWriter(
+        { 1h, 2 },
+        std::make_exception_ptr(
+            Exception(errc::ServerErrors::UnexpectedStatusCode)));
+
+    std::promise<void> p1, p2;
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 2 } } },
+                   MakeHandler(p2));
+
+    EXPECT_THROW_AS(p1.get_future().get(),
+                    errc::ServerErrors::UnexpectedStatusCode);
+    EXPECT_THROW_AS(p2.get_future().get(),
+                    errc::ServerErrors::UnexpectedStatusCode);
+}
+
+TEST_F(BatchWriterTestFixture, ShrinkAdaptiveBatchAfterFailure)
+{
+    auto writer = ConstructWriter(
+        { 1h, 4, false, false, { { 1, 8, 1s } } },
+        std::make_exception_ptr(
+            Exception(errc::ServerErrors::UnexpectedStatusCode)));
+    EXPECT_EQ(writer->Stats().batchSize, 4);
+
+    std::promise<void> p1;
+    writer->Append(Target("db", "rp"),
+                   std::vector<Point>(4, Point{ "m", { { "a", 1 } } }),
+                   MakeHandler(p1));
+    EXPECT_THROW_AS(p1.get_future().get(),
+                    errc::ServerErrors::UnexpectedStatusCode);
+
+    auto stats = writer->Stats();
+    EXPECT_EQ(stats.batchSize, 2);
+    EXPECT_EQ(stats.flushes, 1);
+    EXPECT_EQ(stats.failures, 1);
+
+    std::promise<void> p2;
+    writer->Append(Target("db", "rp"),
+                   std::vector<Point>(2, Point{ "m", { { "a", 1 } } }),
+                   MakeHandler(p2));
+    EXPECT_THROW_AS(p2.get_future().get(),
+                    errc::ServerErrors::UnexpectedStatusCode);
+    EXPECT_EQ(writer->Stats().batchSize, 1);
+    EXPECT_EQ(Flushes().size(), 2);
+}
+
+TEST_F(BatchWriterTestFixture, CompletePendingBatchWhenStopped)
+{
+    auto writer = ConstructWriter({ 1h, 100 });
+
+    std::promise<void> p1;
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Stop();
+
+    auto f1 = p1.get_future();
+    ASSERT_EQ(f1.wait_for(0s), std::future_status::ready);
+    EXPECT_NO_THROW(f1.get());
+    EXPECT_EQ(Flushes().size(), 1);
+}
+
+TEST_F(BatchWriterTestFixture, DropUnfinishedFlushWhenStopTimesOut)
+{
+    BatchConfig config{ 1h, 100 };
+    config.stopTimeout = 50ms;
+    // The flush never completes.
+    auto writer = batch::BatchWriter::Construct(
+        ctx_(),
+        config,
+        [](batch::BatchWriter::Target,
+           std::vector<Point>,
+           batch::BatchWriter::Handler) { });
+
+    std::promise<void> p1;
+    writer->Append(Target("db", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Stop();
+
+    auto f1 = p1.get_future();
+    ASSERT_EQ(f1.wait_for(0s), std::future_status::ready);
+    EXPECT_THROW_AS(f1.get(), errc::RuntimeErrors::WriteDropped);
+}
+
+TEST_F(BatchWriterTestFixture, RejectInvalidWriteWithoutFlushing)
+{
+    auto writer = ConstructWriter({ 1h, 1 });
+
+    std::promise<void> p1, p2, p3;
+    writer->Append(Target("", "rp"),
+                   Point{ "m", { { "a", 1 } } },
+                   MakeHandler(p1));
+    writer->Append(Target("db", "rp"),
+                   Point{ {}, { { "a", 1 } } },
+                   MakeHandler(p2));
+    writer->Append(Target("db", "rp"), Point{ "m", {} }, MakeHandler(p3));
+
+    EXPECT_THROW_AS(p1.get_future().get(), errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(p2.get_future().get(), errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(p3.get_future().get(), errc::LogicErrors::InvalidArgument);
+    EXPECT_TRUE(Flushes().empty());
+}
+
+} // namespace opengemini::test
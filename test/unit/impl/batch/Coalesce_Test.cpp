@@ -0,0 +1,101 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/batch/Coalesce.hpp"
+
+using namespace std::chrono_literals;
+
+namespace opengemini::test {
+
+using namespace opengemini::impl;
+
+TEST(CoalesceTest, GroupPointsBySeries)
+{
+    std::vector<Point> points{
+        { "m", { { "a", 1 } }, Point::Time{ 1s }, { { "T0", "0" } } },
+        { "n", { { "a", 2 } }, Point::Time{ 1s }, { { "T0", "0" } } },
+        { "m", { { "a", 3 } }, Point::Time{ 2s }, { { "T0", "1" } } },
+        { "m", { { "a", 4 } }, Point::Time{ 2s }, { { "T0", "0" } } },
+    };
+
+    batch::CoalescePoints(points, false);
+    ASSERT_EQ(points.size(), 4);
+    EXPECT_EQ(std::get<int64_t>(points[0].fields.at("a")), 1);
+    EXPECT_EQ(std::get<int64_t>(points[1].fields.at("a")), 4);
+    EXPECT_EQ(std::get<int64_t>(points[2].fields.at("a")), 2);
+    EXPECT_EQ(std::get<int64_t>(points[3].fields.at("a")), 3);
+}
+
+TEST(CoalesceTest, MergePointsOfSameSeriesAndTime)
+{
+    std::vector<Point> points{
+        { "m", { { "a", 1 }, { "b", 1 } }, Point::Time{ 1s } },
+        { "m", { { "a", 2 } }, Point::Time{ 2s } },
+        { "m", { { "b", 3 }, { "c", 3 } }, Point::Time{ 1s } },
+        { "m", { { "c", 4 } }, Point::Time{ 1s }, {}, Precision::Second },
+    };
+
+    batch::CoalescePoints(points, false);
+    ASSERT_EQ(points.size(), 3);
+    EXPECT_EQ(points[0].time, Point::Time{ 1s });
+    ASSERT_EQ(points[0].fields.size(), 3);
+    EXPECT_EQ(std::get<int64_t>(points[0].fields.at("a")), 1);
+    EXPECT_EQ(std::get<int64_t>(points[0].fields.at("b")), 3);
+    EXPECT_EQ(std::get<int64_t>(points[0].fields.at("c")), 3);
+    EXPECT_EQ(points[1].time, Point::Time{ 2s });
+    // Points of different precision are not merged.
+    EXPECT_EQ(points[2].precision, Precision::Second);
+}
+
+TEST(CoalesceTest, SortPointsOfSeriesByTime)
+{
+    std::vector<Point> points{
+        { "m", { { "a", 1 } }, Point::Time{ 3s } },
+        { "n", { { "a", 2 } }, Point::Time{ 1s } },
+        { "m", { { "a", 3 } }, Point::Time{ 1s } },
+        { "m", { { "a", 4 } }, Point::Time{ 2s } },
+        { "m", { { "b", 5 } }, Point::Time{ 1s } },
+    };
+
+    batch::CoalescePoints(points, true);
+    ASSERT_EQ(points.size(), 4);
+    EXPECT_EQ(points[0].time, Point::Time{ 1s });
+    EXPECT_EQ(points[0].fields.size(), 2);
+    EXPECT_EQ(points[1].time, Point::Time{ 2s });
+    EXPECT_EQ(points[2].time, Point::Time{ 3s });
+    EXPECT_EQ(points[3].measurement, "n");
+}
+
+TEST(CoalesceTest, KeepPointsWithoutTimestamp)
+{
+    std::vector<Point> points{
+        { "m", { { "a", 1 } } },
+        { "m", { { "a", 2 } }, Point::Time{ 1s } },
+        { "m", { { "a", 3 } } },
+        { "m", { { "a", 4 } }, Point::Time{ 1ms }, {}, Precision::Second },
+        { "m", { { "a", 5 } } },
+    };
+
+    batch::CoalescePoints(points, false);
+    ASSERT_EQ(points.size(), 5);
+    for (std::size_t idx = 0; idx < points.size(); ++idx) {
+        EXPECT_EQ(std::get<int64_t>(points[idx].fields.at("a")),
+                  static_cast<int64_t>(idx + 1));
+    }
+}
+
+} // namespace opengemini::test
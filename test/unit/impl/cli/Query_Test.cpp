@@ -47,6 +47,23 @@ TEST_F(QueryTestFixture, Success)
     EXPECT_NO_THROW(impl_.Query({ "db", "command" }, token::sync));
 }
 
+TEST_F(QueryTestFixture, EncodeParameters)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendRequest(testing::_,
+                            IsQueryTargetEq("/query?db=my%20db&q=select%20%2A"
+                                            "%20from%20m%20where%20a%3D%271%26"
+                                            "2%27&rp=rp%231&epoch=ns"),
+                            testing::_))
+        .Times(1)
+        .WillRepeatedly(
+            testing::Return(http::Response{ http::Status::ok, 11, "{}" }));
+
+    EXPECT_NO_THROW(impl_.Query(
+        { "my db", "select * from m where a='1&2'", "rp#1" },
+        token::sync));
+}
+
 TEST_F(QueryTestFixture, EmptyCommand)
 {
     EXPECT_CALL(*mockHttp_, SendRequest(testing::_, testing::_, testing::_))
@@ -56,4 +73,72 @@ TEST_F(QueryTestFixture, EmptyCommand)
                     errc::LogicErrors::InvalidArgument);
 }
 
+TEST_F(QueryTestFixture, ColumnarSuccess)
+{
+    EXPECT_CALL(
+        *mockHttp_,
+        SendRequest(testing::_,
+                    IsQueryTargetEq("/query?db=db&q=command&rp=&epoch=ns"),
+                    testing::_))
+        .Times(1)
+        .WillRepeatedly(testing::Return(http::Response{
+            http::Status::ok,
+            11,
+            R"({"results":[{"series":[{"name":"m","columns":["time","v"],)"
+            R"("values":[[1,1.5],[2,null]]}]}]})" }));
+
+    auto result =
+        impl_.Query({ "db", "command" }, format::columnar, token::sync);
+    ASSERT_EQ(result.results.size(), 1);
+    ASSERT_EQ(result.results[0].series.size(), 1);
+    auto& series = result.results[0].series[0];
+    EXPECT_EQ(series.times, (std::vector<int64_t>{ 1, 2 }));
+    ASSERT_EQ(series.columns.size(), 1);
+    EXPECT_EQ(series.columns[0].nulls, (std::vector<bool>{ false, true }));
+}
+
+TEST_F(QueryTestFixture, ChunkedSuccess)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendRequest(testing::_,
+                            IsQueryTargetEq("/query?db=db&q=command&rp=&epoch="
+                                            "ns&chunked=true&chunk_size=2"),
+                            testing::_))
+        .Times(1)
+        .WillRepeatedly(testing::Return(http::Response{
+            http::Status::ok,
+            11,
+            R"({"results":[{"series":[{"name":"m","values":[[1],[2]]}]}]})"
+            "\n"
+            R"({"results":[{"series":[{"name":"m","values":[[3]]}]}]})"
+            "\n" }));
+
+    std::vector<Series> received;
+    EXPECT_NO_THROW(impl_.QueryChunked(
+        { "db", "command" },
+        2,
+        [&received](Series series) { received.push_back(std::move(series)); },
+        token::sync));
+
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(received[0].values.size(), 2);
+    EXPECT_EQ(received[1].values.size(), 1);
+}
+
+TEST_F(QueryTestFixture, ChunkedErrorResult)
+{
+    EXPECT_CALL(*mockHttp_, SendRequest(testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillRepeatedly(testing::Return(http::Response{
+            http::Status::ok,
+            11,
+            R"({"results":[{"error":"shard not found"}]})" }));
+
+    EXPECT_THROW_AS(impl_.QueryChunked({ "db", "command" },
+                                       0,
+                                       [](Series) {},
+                                       token::sync),
+                    errc::ServerErrors::ErrorResult);
+}
+
 } // namespace opengemini::test
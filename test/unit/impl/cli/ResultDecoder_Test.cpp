@@ -0,0 +1,239 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "opengemini/Exception.hpp"
+#include "opengemini/impl/cli/query/ResultDecoder.hpp"
+#include "test/ExpectThrowAs.hpp"
+
+namespace opengemini::test {
+
+using namespace opengemini::impl;
+
+namespace {
+
+void ExpectSameResult(const QueryResult& lhs, const QueryResult& rhs)
+{
+    EXPECT_EQ(lhs.error, rhs.error);
+    ASSERT_EQ(lhs.results.size(), rhs.results.size());
+    for (std::size_t idx = 0; idx < lhs.results.size(); ++idx) {
+        auto& left  = lhs.results[idx];
+        auto& right = rhs.results[idx];
+        EXPECT_EQ(left.error, right.error);
+        ASSERT_EQ(left.series.size(), right.series.size());
+        for (std::size_t seq = 0; seq < left.series.size(); ++seq) {
+            EXPECT_EQ(left.series[seq].name, right.series[seq].name);
+            EXPECT_EQ(left.series[seq].tags, right.series[seq].tags);
+            EXPECT_EQ(left.series[seq].columns, right.series[seq].columns);
+            EXPECT_EQ(left.series[seq].values, right.series[seq].values);
+        }
+    }
+}
+
+} // namespace
+
+TEST(ResultDecoderTest, SameAsDocumentConversion)
+{
+    constexpr std::string_view body{ R"({
+        "results": [
+            {
+                "statement_id": 0,
+                "series": [
+                    {
+                        "name": "cpu",
+                        "tags": { "host": "server-0", "rack": "1" },
+                        "columns": [ "time", "f", "i", "u", "s", "b", "n" ],
+                        "values": [
+                            [ 1, 1.5, -2, 3, "x", true, null ],
+                            [ 2, 2.5, -3, 4, "y", false, null ]
+                        ]
+                    },
+                    { "name": "mem", "columns": [ "time" ] }
+                ]
+            },
+            { "statement_id": 1, "error": "statement error" }
+        ],
+        "error": "query error"
+    })" };
+
+    auto decoded  = cli::DecodeQueryResult(body);
+    auto expected = nlohmann::json::parse(body).get<QueryResult>();
+    ExpectSameResult(decoded, expected);
+
+    ASSERT_EQ(decoded.results.size(), 2);
+    ASSERT_EQ(decoded.results[0].series.size(), 2);
+    auto& rows = decoded.results[0].series[0].values;
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(std::get<uint64_t>(rows[0][0]), 1);
+    EXPECT_EQ(std::get<double>(rows[0][1]), 1.5);
+    EXPECT_EQ(std::get<int64_t>(rows[0][2]), -2);
+    EXPECT_EQ(std::get<std::string>(rows[1][4]), "y");
+    EXPECT_EQ(std::get<bool>(rows[1][5]), false);
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(rows[1][6]));
+    EXPECT_EQ(decoded.results[1].error, "statement error");
+    EXPECT_EQ(decoded.error, "query error");
+}
+
+TEST(ResultDecoderTest, IgnoreUnknownKeys)
+{
+    auto decoded = cli::DecodeQueryResult(R"({
+        "results": [ {
+            "messages": [ { "level": "warning", "text": "deprecated" } ],
+            "partial": true,
+            "series": [ {
+                "name": "m",
+                "extra": { "nested": [ 1, { "deeper": [] } ] },
+                "columns": [ "time", "v" ],
+                "values": [ [ 1, [ 2, 3 ] ], [ 2, { "a": 1 } ] ]
+            } ]
+        } ],
+        "error": null
+    })");
+
+    ASSERT_EQ(decoded.results.size(), 1);
+    ASSERT_EQ(decoded.results[0].series.size(), 1);
+    auto& series = decoded.results[0].series[0];
+    EXPECT_EQ(series.name, "m");
+    ASSERT_EQ(series.values.size(), 2);
+    ASSERT_EQ(series.values[0].size(), 2);
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(series.values[0][1]));
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(series.values[1][1]));
+    EXPECT_TRUE(decoded.error.empty());
+}
+
+TEST(ResultDecoderTest, MalformedResponse)
+{
+    EXPECT_THROW_AS(cli::DecodeQueryResult(""),
+                    errc::RuntimeErrors::Unexpected);
+    EXPECT_THROW_AS(cli::DecodeQueryResult(R"({"results": [)"),
+                    errc::RuntimeErrors::Unexpected);
+    EXPECT_THROW_AS(cli::DecodeQueryResult("[]"),
+                    errc::RuntimeErrors::Unexpected);
+    EXPECT_THROW_AS(cli::DecodeQueryResult(R"({"results": {}})"),
+                    errc::RuntimeErrors::Unexpected);
+    EXPECT_THROW_AS(cli::DecodeQueryResult(R"({"error": 1})"),
+                    errc::RuntimeErrors::Unexpected);
+    EXPECT_THROW_AS(cli::DecodeQueryResult(
+                        R"({"results": [{"series": [{"columns": [1]}]}]})"),
+                    errc::RuntimeErrors::Unexpected);
+    EXPECT_THROW_AS(cli::DecodeQueryResult(
+                        R"({"results": [{"series": [{"values": [1]}]}]})"),
+                    errc::RuntimeErrors::Unexpected);
+}
+
+TEST(ColumnarDecoderTest, DecodeTypedColumns)
+{
+    constexpr std::string_view body{ R"({
+        "results": [
+            {
+                "series": [
+                    {
+                        "name": "cpu",
+                        "tags": { "host": "server-0" },
+                        "columns": [ "time", "f", "i", "u", "s", "b", "n" ],
+                        "values": [
+                            [ 1, 1.5, -2, 3, "x", true, null ],
+                            [ 2, 2, 4, 18446744073709551615, "y", false ],
+                            [ 3, null, 6, 5, "x", true, null ]
+                        ]
+                    }
+                ]
+            }
+        ]
+    })" };
+
+    auto result = cli::DecodeColumnarResult(body);
+    ASSERT_EQ(result.results.size(), 1);
+    ASSERT_EQ(result.results[0].series.size(), 1);
+    auto& series = result.results[0].series[0];
+    EXPECT_EQ(series.name, "cpu");
+    EXPECT_EQ(series.tags.at("host"), "server-0");
+    EXPECT_EQ(series.rows, 3);
+    EXPECT_EQ(series.times, (std::vector<int64_t>{ 1, 2, 3 }));
+    ASSERT_EQ(series.columns.size(), 6);
+
+    auto& floats = series.columns[0];
+    EXPECT_EQ(floats.name, "f");
+    ASSERT_TRUE(std::holds_alternative<std::vector<double>>(floats.values));
+    EXPECT_EQ(std::get<std::vector<double>>(floats.values)[1], 2.0);
+    EXPECT_EQ(floats.nulls, (std::vector<bool>{ false, false, true }));
+
+    EXPECT_EQ(std::get<std::vector<int64_t>>(series.columns[1].values),
+              (std::vector<int64_t>{ -2, 4, 6 }));
+    EXPECT_TRUE(series.columns[1].nulls.empty());
+
+    EXPECT_EQ(
+        std::get<std::vector<uint64_t>>(series.columns[2].values),
+        (std::vector<uint64_t>{ 3, 18446744073709551615ULL, 5 }));
+
+    auto& strings = std::get<StringColumn>(series.columns[3].values);
+    EXPECT_EQ(strings.dictionary, (std::vector<std::string>{ "x", "y" }));
+    EXPECT_EQ(strings.codes, (std::vector<uint32_t>{ 0, 1, 0 }));
+
+    EXPECT_EQ(std::get<std::vector<bool>>(series.columns[4].values),
+              (std::vector<bool>{ true, false, true }));
+
+    EXPECT_TRUE(
+        std::holds_alternative<std::monostate>(series.columns[5].values));
+    EXPECT_EQ(series.columns[5].nulls, (std::vector<bool>{ true, true, true }));
+}
+
+TEST(ColumnarDecoderTest, RejectMixedColumn)
+{
+    EXPECT_THROW_AS(
+        cli::DecodeColumnarResult(
+            R"({"results":[{"series":[{"columns":["time","v"],)"
+            R"("values":[[1,1],[2,"x"]]}]}]})"),
+        errc::RuntimeErrors::Unexpected);
+}
+
+TEST(ChunkDecoderTest, DecodeLinesAcrossReads)
+{
+    std::vector<std::string> names;
+    cli::ChunkDecoder        decoder(
+        [&names](Series series) { names.push_back(std::move(series.name)); });
+
+    std::string body{ R"({"results":[{"series":[{"name":"a"}]}]})"
+                      "\n"
+                      R"({"results":[{"series":[{"na)" };
+    decoder.Consume(body);
+    EXPECT_EQ(names, std::vector<std::string>{ "a" });
+    // Only the incomplete line is kept.
+    EXPECT_EQ(body, R"({"results":[{"series":[{"na)");
+
+    body.append(R"(me":"b"},{"name":"c"}]}]})");
+    decoder.Consume(body);
+    EXPECT_EQ(names, std::vector<std::string>{ "a" });
+
+    decoder.Finish(body);
+    EXPECT_EQ(names, (std::vector<std::string>{ "a", "b", "c" }));
+    EXPECT_TRUE(body.empty());
+}
+
+TEST(ChunkDecoderTest, StopAtErrorChunk)
+{
+    std::size_t       received{ 0 };
+    cli::ChunkDecoder decoder([&received](Series) { ++received; });
+
+    std::string body{ R"({"results":[{"series":[{"name":"a"}]}]})"
+                      "\n"
+                      R"({"results":[{"error":"query interrupted"}]})"
+                      "\n" };
+    EXPECT_THROW_AS(decoder.Consume(body), errc::ServerErrors::ErrorResult);
+    EXPECT_EQ(received, 1);
+}
+
+} // namespace opengemini::test
@@ -12,12 +12,46 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "opengemini/CompletionToken.hpp"
 #include "test/ClientImplTestFixture.hpp"
 #include "test/ExpectThrowAs.hpp"
+#include "test/BodySource.hpp"
+
+namespace opengemini::test {
+
+struct Sample {
+    std::string tag;
+    double      value;
+    Point::Time time;
+};
+
+} // namespace opengemini::test
+
+namespace opengemini {
+
+template<>
+struct Schema<test::Sample> {
+    static constexpr auto measurement = schema::Measurement("test");
+    static constexpr auto tags =
+        std::make_tuple(schema::Tag("T0", &test::Sample::tag));
+    static constexpr auto fields =
+        std::make_tuple(schema::Field("a", &test::Sample::value));
+    static constexpr auto time = &test::Sample::time;
+};
+
+} // namespace opengemini
 
 namespace opengemini::test {
 
@@ -26,6 +60,9 @@ using namespace duration_literals;
 
 class WriteTestFixture : public test::ClientImplTestFixture { };
 
+OPENGEMINI_TEST_MEMBER_HACKER(lb::LoadBalancer,
+                              &lb::LoadBalancer::servers_) // 0
+
 MATCHER_P(IsTargetEq,
           expect,
           "Target"s + (negation ? "is" : "isn't") + " equal to " +
@@ -44,6 +81,20 @@ MATCHER_P(IsTargetEq,
         .WillOnce(testing::Return(                                             \
             http::Response{ http::Status::no_content, 11, "{}" }))
 
+#define EXPECT_STREAM_TARGET(TARGET, BODY)                                     \
+    EXPECT_CALL(*mockHttp_,                                                    \
+                SendStreamRequest(                                             \
+                    testing::Field(&Endpoint::host, testing::Eq("127.0.0.1")), \
+                    IsTargetEq(TARGET),                                        \
+                    testing::_))                                               \
+        .WillOnce([expect = std::string(BODY)](const Endpoint&,               \
+                                               http::StreamRequest request,   \
+                                               auto) {                        \
+            EXPECT_TRUE(request.chunked());                                    \
+            EXPECT_EQ(ReadBodySource(*request.body()), expect);                \
+            return http::Response{ http::Status::no_content, 11, "{}" };       \
+        })
+
 TEST_F(WriteTestFixture, SingleWriteSuccess)
 {
     EXPECT_TARGET(R"(/write?db=test_db_cxx&rp=)");
@@ -61,6 +112,42 @@ TEST_F(WriteTestFixture, SingleWriteSuccess)
         token::sync);
 }
 
+TEST_F(WriteTestFixture, WriteWithPrecision)
+{
+    Point point{ "test", { { "a", 1 } }, Point::Time{ 2s }, { { "T0", "0" } } };
+    point.precision = Precision::Second;
+
+    EXPECT_TARGET(R"(/write?db=test_db_cxx&rp=&precision=s)");
+    impl_.Write<Point>("test_db_cxx", point, {}, token::sync);
+
+    std::vector<Point> points{ point, point };
+    points[1].time      = Point::Time{ 3500ms };
+    points[1].precision = Precision::Millisecond;
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=&precision=ms)",
+                         "test,T0=0 a=1i 2000\ntest,T0=0 a=1i 3500\n");
+    impl_.Write<std::vector<Point>>("test_db_cxx", points, {}, token::sync);
+}
+
+TEST_F(WriteTestFixture, WriteToBoundTarget)
+{
+    auto target =
+        std::make_shared<const cli::WriteTarget>("test db&1", "rp=1");
+
+    EXPECT_TARGET(R"(/write?db=test%20db%261&rp=rp%3D1)");
+    impl_.Write<Point>(
+        target,
+        { "test", { { "a", 1 } }, Point::Time{ 1ns }, { { "T0", "0" } } },
+        token::sync);
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test%20db%261&rp=rp%3D1)",
+                         "test,T0=0 a=1i 1\n");
+    impl_.Write<std::vector<Point>>(
+        target,
+        { { "test", { { "a", 1 } }, Point::Time{ 1ns }, { { "T0", "0" } } } },
+        token::sync);
+}
+
 TEST_F(WriteTestFixture, SingleWriteWithInvalidEmptyDatabaseName)
 {
     EXPECT_CALL(*mockHttp_, SendRequest(testing::_, testing::_, testing::_))
@@ -104,10 +191,12 @@ TEST_F(WriteTestFixture, MultipleWriteSuccess)
         { "test", { { "a", 1 } }, Point::Time{ 1ns }, { { "T0", "0" } } },
     };
 
-    EXPECT_TARGET(R"(/write?db=test_db_cxx&rp=)");
+    const auto body = "test,T0=0 a=1i 1\ntest,T0=0 a=1i 1\ntest,T0=0 a=1i 1\n";
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=)", body);
     impl_.Write<std::vector<Point>>("test_db_cxx", points, {}, token::sync);
 
-    EXPECT_TARGET(R"(/write?db=test_db_cxx&rp=test_rp_cxx)");
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=test_rp_cxx)", body);
     impl_.Write<std::vector<Point>>("test_db_cxx",
                                     std::move(points),
                                     "test_rp_cxx",
@@ -116,7 +205,8 @@ TEST_F(WriteTestFixture, MultipleWriteSuccess)
 
 TEST_F(WriteTestFixture, MultipleWriteWithEmptyPointsVector)
 {
-    EXPECT_CALL(*mockHttp_, SendRequest(testing::_, testing::_, testing::_))
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
         .Times(0);
 
     EXPECT_NO_THROW(
@@ -125,7 +215,8 @@ TEST_F(WriteTestFixture, MultipleWriteWithEmptyPointsVector)
 
 TEST_F(WriteTestFixture, MultipleWriteWithInvalidPoints)
 {
-    EXPECT_CALL(*mockHttp_, SendRequest(testing::_, testing::_, testing::_))
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
         .Times(0);
 
     EXPECT_THROW_AS(
@@ -149,6 +240,435 @@ TEST_F(WriteTestFixture, MultipleWriteWithInvalidPoints)
                                         "test_rp_cxx",
                                         token::sync),
         errc::LogicErrors::InvalidArgument);
+
+    EXPECT_THROW_AS(
+        impl_.Write<std::vector<Point>>(
+            "test_db_cxx",
+            {
+                { "test", { { "a", 1 } } },
+                { "test",
+                  { { "a", std::numeric_limits<double>::infinity() } } },
+            },
+            "test_rp_cxx",
+            token::sync),
+        errc::LogicErrors::InvalidArgument);
+}
+
+TEST_F(WriteTestFixture, MultipleWriteLargerThanOneChunk)
+{
+    std::vector<Point> points(
+        50000,
+        { "test", { { "a", 1 } }, Point::Time{ 1ns }, { { "T0", "0" } } });
+    std::string body;
+    for (std::size_t idx = 0; idx < points.size(); ++idx) {
+        body += "test,T0=0 a=1i 1\n";
+    }
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=)", body);
+    impl_.Write<std::vector<Point>>("test_db_cxx", points, {}, token::sync);
+}
+
+TEST_F(WriteTestFixture, SpanWriteSuccess)
+{
+    const Point points[]{
+        { "test", { { "a", 1 } }, Point::Time{ 1ns }, { { "T0", "0" } } },
+        { "test", { { "a", 2 } }, Point::Time{ 2ns }, { { "T0", "1" } } },
+        { "test", { { "a", 3 } }, Point::Time{ 3ns }, { { "T0", "2" } } },
+    };
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=)",
+                         "test,T0=0 a=1i 1\ntest,T0=1 a=2i 2\n"
+                         "test,T0=2 a=3i 3\n");
+    impl_.Write<PointSpan>("test_db_cxx", points, {}, token::sync);
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=test_rp_cxx)",
+                         "test,T0=1 a=2i 2\n");
+    impl_.Write<PointSpan>("test_db_cxx",
+                           { points + 1, 1 },
+                           "test_rp_cxx",
+                           token::sync);
+}
+
+TEST_F(WriteTestFixture, SpanWriteWithInvalidPoints)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .Times(0);
+
+    EXPECT_NO_THROW(
+        impl_.Write<PointSpan>("test_db_cxx", {}, {}, token::sync));
+
+    std::vector<Point> points{
+        { "test", { { "a", 1 } } },
+        { "test", {} },
+    };
+    EXPECT_THROW_AS(
+        impl_.Write<PointSpan>("test_db_cxx", points, {}, token::sync),
+        errc::LogicErrors::InvalidArgument);
+}
+
+TEST_F(WriteTestFixture, PointBatchWriteSuccess)
+{
+    PointBatch batch{ "test",
+                      { { "a", std::vector<int64_t>{ 1, 2, 3 } },
+                        { "b", std::vector<std::string>{ "x", "y", "z" } } },
+                      { Point::Time{ 1ns }, Point::Time{ 2ns }, Point::Time{} },
+                      { { "T0", "0" } } };
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=test_rp_cxx)",
+                         "test,T0=0 a=1i,b=\"x\" 1\n"
+                         "test,T0=0 a=2i,b=\"y\" 2\n"
+                         "test,T0=0 a=3i,b=\"z\"\n");
+    impl_.Write<PointBatch>("test_db_cxx",
+                            std::move(batch),
+                            "test_rp_cxx",
+                            token::sync);
+}
+
+TEST_F(WriteTestFixture, PointBatchWriteWithInvalidColumns)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .Times(0);
+
+    EXPECT_THROW_AS(
+        impl_.Write<PointBatch>(
+            "test_db_cxx",
+            { "test",
+              { { "a", std::vector<double>{ 1.5 } } },
+              { Point::Time{ 1ns }, Point::Time{ 2ns } } },
+            {},
+            token::sync),
+        errc::LogicErrors::InvalidArgument);
+}
+
+TEST_F(WriteTestFixture, RecordsWriteSuccess)
+{
+    std::vector<Sample> records{
+        { "0", 1.5, Point::Time{ 1ns } },
+        { "1", 2, Point::Time{ 2ns } },
+    };
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=)",
+                         "test,T0=0 a=1.5 1\ntest,T0=1 a=2 2\n");
+    impl_.Write<std::vector<Sample>>("test_db_cxx",
+                                     std::move(records),
+                                     {},
+                                     token::sync);
+}
+
+TEST_F(WriteTestFixture, RecordsWriteWithInvalidFloat)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .Times(0);
+
+    EXPECT_THROW_AS(
+        impl_.Write<std::vector<Sample>>(
+            "test_db_cxx",
+            { { "0", 1.5 }, { "1", std::numeric_limits<double>::infinity() } },
+            {},
+            token::sync),
+        errc::LogicErrors::InvalidArgument);
+}
+
+TEST_F(WriteTestFixture, RawWriteSuccess)
+{
+    const std::string lines("test,T0=0 a=1i 1\ntest,T0=1 a=2i 2\n");
+
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=test_rp_cxx)", lines);
+    impl_.Write<cli::RawBody>(
+        "test_db_cxx",
+        { { std::string_view(lines).substr(0, 20),
+            std::string_view(lines).substr(20) },
+          nullptr },
+        "test_rp_cxx",
+        token::sync);
+}
+
+TEST_F(WriteTestFixture, RawWriteWithEmptyBody)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .Times(0);
+    impl_.Write<cli::RawBody>("test_db_cxx",
+                              { { "", "" }, nullptr },
+                              {},
+                              token::sync);
+}
+
+TEST_F(WriteTestFixture, RawWriteWithInvalidLine)
+{
+    EXPECT_CALL(*mockHttp_,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .Times(0);
+    EXPECT_THROW_AS(impl_.Write<cli::RawBody>("test_db_cxx",
+                                              { { "test a=1i\ntest\n" },
+                                                nullptr },
+                                              {},
+                                              token::sync),
+                    errc::LogicErrors::InvalidArgument);
+}
+
+TEST_F(WriteTestFixture, RawWriteWithoutValidation)
+{
+    // Left to the server to reject.
+    EXPECT_STREAM_TARGET(R"(/write?db=test_db_cxx&rp=)", "test a=1i\ntest\n");
+    impl_.Write<cli::RawBody>("test_db_cxx",
+                              { { "test a=1i\ntest\n" }, nullptr, false },
+                              {},
+                              token::sync);
+}
+
+class SeriesRoutedWriteTestFixture : public test::ClientImplTestFixture {
+protected:
+    SeriesRoutedWriteTestFixture() :
+        ClientImplTestFixture(ClientConfigBuilder()
+                                  .AppendAddress({ "127.0.0.1", 1234 })
+                                  .AppendAddress({ "127.0.0.1", 4321 })
+                                  .AppendAddress({ "127.0.0.1", 5678 })
+                                  .WriteRouting(WriteRouting::BySeries)
+                                  .Finalize())
+    { }
+
+    lb::LoadBalancer& Lb()
+    {
+        return *(impl_.*(std::get<2>(HackingMember(impl_))));
+    }
+
+    void MarkBad(std::uint16_t port)
+    {
+        auto& lb = Lb();
+        for (auto& server : lb.*(std::get<0>(HackingMember(lb)))) {
+            if (server.endpoint.port == port) { server.good = false; }
+        }
+    }
+
+    // One point of each series, which are spread over all the servers.
+    static std::vector<Point> PointsOfSeries(std::size_t count)
+    {
+        std::vector<Point> points;
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            points.push_back({ "test",
+                               { { "a", 1 } },
+                               Point::Time{ 1ns },
+                               { { "T0", std::to_string(idx) } } });
+        }
+        return points;
+    }
+
+    static std::string LineOf(const Point& point)
+    {
+        return "test,T0=" + point.tags.at("T0") + " a=1i 1\n";
+    }
+
+    // Records the body of every write request by the port it is sent to, and
+    // responds with status.
+    void ExpectWrites(std::function<http::Status(std::uint16_t)> status)
+    {
+        EXPECT_CALL(*mockHttp_,
+                    SendStreamRequest(testing::_, testing::_, testing::_))
+            .WillRepeatedly([this, status](const Endpoint&     endpoint,
+                                           http::StreamRequest request,
+                                           auto) {
+                auto body = ReadBodySource(*request.body());
+                {
+                    std::lock_guard lock(mutex_);
+                    sent_.emplace_back(endpoint.port, std::move(body));
+                }
+                return http::Response{ status(endpoint.port), 11, "{}" };
+            });
+    }
+
+protected:
+    std::mutex                                         mutex_;
+    std::vector<std::pair<std::uint16_t, std::string>> sent_;
+};
+
+TEST_F(SeriesRoutedWriteTestFixture, SendSharesToServersOfSeries)
+{
+    auto points = PointsOfSeries(32);
+    std::map<std::uint16_t, std::string> expect;
+    for (auto& point : points) {
+        auto& endpoint = Lb().PickServerOf(cli::detail::SeriesHashOf(point));
+        expect[endpoint.port] += LineOf(point);
+    }
+    ASSERT_EQ(expect.size(), 3);
+
+    ExpectWrites([](auto) { return http::Status::no_content; });
+    impl_.Write<std::vector<Point>>("test_db_cxx", points, {}, token::sync);
+
+    // One request for each server, carrying the lines of its series in order.
+    EXPECT_EQ(sent_.size(), 3);
+    EXPECT_EQ(decltype(expect)(sent_.begin(), sent_.end()), expect);
+}
+
+TEST_F(SeriesRoutedWriteTestFixture, KeepSeriesOnServerWhenAnotherGoesBad)
+{
+    auto points = PointsOfSeries(32);
+    std::vector<std::uint16_t> portOf;
+    for (auto& point : points) {
+        portOf.push_back(
+            Lb().PickServerOf(cli::detail::SeriesHashOf(point)).port);
+    }
+
+    MarkBad(4321);
+    ExpectWrites([](auto) { return http::Status::no_content; });
+    impl_.Write<std::vector<Point>>("test_db_cxx", points, {}, token::sync);
+
+    std::map<std::uint16_t, std::string> received(sent_.begin(), sent_.end());
+    EXPECT_EQ(received.count(4321), 0);
+    for (std::size_t idx = 0; idx < points.size(); ++idx) {
+        if (portOf[idx] == 4321) { continue; }
+        EXPECT_THAT(received[portOf[idx]],
+                    testing::HasSubstr(LineOf(points[idx])));
+    }
+}
+
+TEST_F(SeriesRoutedWriteTestFixture, ReportFailedShare)
+{
+    auto points = PointsOfSeries(32);
+
+    ExpectWrites([](auto port) {
+        return port == 5678 ? http::Status::internal_server_error
+                            : http::Status::no_content;
+    });
+    EXPECT_THROW_AS(impl_.Write<std::vector<Point>>("test_db_cxx",
+                                                    points,
+                                                    {},
+                                                    token::sync),
+                    errc::ServerErrors::UnexpectedStatusCode);
+
+    // The shares of the other servers are still written.
+    std::map<std::uint16_t, std::string> received(sent_.begin(), sent_.end());
+    EXPECT_EQ(received.size(), 3);
+}
+
+TEST(BatchedWriteTest, WritePendingBatchWhenDestroyed)
+{
+    auto impl = std::make_unique<ClientImpl>(
+        ClientConfigBuilder()
+            .AppendAddress({ "127.0.0.1", 1234 })
+            .BatchConfig(1h, 100)
+            .Finalize());
+    auto  hackImpl = HackingMember(*impl);
+    auto& ctx      = (*impl).*(std::get<0>(hackImpl));
+    auto  mockHttp = std::make_shared<MockIHttpClient>(ctx());
+    (*impl).*(std::get<1>(hackImpl)) = mockHttp;
+
+    EXPECT_CALL(*mockHttp,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(
+            http::Response{ http::Status::no_content, 11, "{}" }));
+
+    auto written = impl->Write<Point>("test_db_cxx",
+                                      { "test", { { "a", 1 } } },
+                                      {},
+                                      token::future);
+    impl.reset();
+
+    ASSERT_EQ(written.wait_for(0s), std::future_status::ready);
+    EXPECT_NO_THROW(written.get());
+}
+
+TEST(ReplicatedWriteTest, SpillWriteFailedByGroupUnderQuorum)
+{
+    auto directory =
+        std::filesystem::temp_directory_path() / "opengemini-replicated-write";
+    std::filesystem::remove_all(directory);
+
+    auto config = ClientConfigBuilder()
+                      .AppendAddress({ "127.0.0.1", 1234 })
+                      .SpillConfig(directory.string(), 1024 * 1024, 1024)
+                      .ReplicationConfig({ { { "127.0.0.1", 2001 } },
+                                           { { "127.0.0.1", 2002 } } },
+                                         AckPolicy::Quorum)
+                      .Finalize();
+    config.replicationConfig->retryInterval = 1ms;
+    auto  impl     = std::make_unique<ClientImpl>(config);
+    auto  hackImpl = HackingMember(*impl);
+    auto& ctx      = (*impl).*(std::get<0>(hackImpl));
+    auto  mockHttp = std::make_shared<MockIHttpClient>(ctx());
+    (*impl).*(std::get<1>(hackImpl)) = mockHttp;
+
+    auto respond = [](const Endpoint& endpoint, auto, auto) {
+        return http::Response{ endpoint.port == 2002
+                                   ? http::Status::internal_server_error
+                                   : http::Status::no_content,
+                               11,
+                               "{}" };
+    };
+    EXPECT_CALL(*mockHttp,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .WillRepeatedly(respond);
+    EXPECT_CALL(*mockHttp, SendRequest(testing::_, testing::_, testing::_))
+        .WillRepeatedly(respond);
+
+    EXPECT_NO_THROW(impl->Write<Point>("test_db_cxx",
+                                       { "test", { { "a", 1 } } },
+                                       {},
+                                       token::sync));
+
+    auto& spills = (*impl).*(std::get<3>(hackImpl));
+    ASSERT_EQ(spills.size(), 2);
+    for (auto waited = 0ms; spills[1]->DiskBytes() == 0 && waited < 5s;
+         waited += 10ms) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_GT(spills[1]->DiskBytes(), 0);
+    EXPECT_EQ(spills[0]->DiskBytes(), 0);
+
+    impl.reset();
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ReplicatedWriteTest, KeepRawBodyForGroupStillRetrying)
+{
+    auto config = ClientConfigBuilder()
+                      .AppendAddress({ "127.0.0.1", 1234 })
+                      .ReplicationConfig({ { { "127.0.0.1", 2001 } },
+                                           { { "127.0.0.1", 2002 } } },
+                                         AckPolicy::Quorum)
+                      .Finalize();
+    config.replicationConfig->retryInterval = 50ms;
+    auto  impl     = std::make_unique<ClientImpl>(config);
+    auto  hackImpl = HackingMember(*impl);
+    auto& ctx      = (*impl).*(std::get<0>(hackImpl));
+    auto  mockHttp = std::make_shared<MockIHttpClient>(ctx());
+    (*impl).*(std::get<1>(hackImpl)) = mockHttp;
+
+    std::atomic<int>          attempts{ 0 };
+    std::promise<std::string> retried;
+    EXPECT_CALL(*mockHttp,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .WillRepeatedly([&attempts, &retried](const Endpoint&     endpoint,
+                                              http::StreamRequest request,
+                                              auto) {
+            if (endpoint.port == 2002 && attempts++ == 0) {
+                return http::Response{ http::Status::internal_server_error,
+                                       11,
+                                       "{}" };
+            }
+            if (endpoint.port == 2002) {
+                retried.set_value(ReadBodySource(*request.body()));
+            }
+            return http::Response{ http::Status::no_content, 11, "{}" };
+        });
+
+    auto body = std::make_shared<std::string>("test a=1i\n");
+    EXPECT_NO_THROW(impl->Write<cli::RawBody>("test_db_cxx",
+                                              { { *body }, body },
+                                              {},
+                                              token::sync));
+    // The caller is free to reuse the buffers once the write completes.
+    body->assign(body->size(), 'x');
+    body.reset();
+
+    auto sent = retried.get_future();
+    ASSERT_EQ(sent.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(sent.get(), "test a=1i\n");
+
+    impl.reset();
 }
 
 } // namespace opengemini::test
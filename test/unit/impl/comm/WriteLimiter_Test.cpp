@@ -0,0 +1,210 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/comm/WriteLimiter.hpp"
+#include "test/ExpectThrowAs.hpp"
+#include "test/TestFixtureWithContext.hpp"
+
+namespace opengemini::test {
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// Records how the task of a write was invoked.
+struct Outcome {
+    std::promise<std::exception_ptr> promise;
+    std::future<std::exception_ptr>  future{ promise.get_future() };
+
+    impl::WriteLimiter::Task Task()
+    {
+        return [this](std::exception_ptr error) { promise.set_value(error); };
+    }
+
+    bool Ready() { return future.wait_for(0s) == std::future_status::ready; }
+
+    std::exception_ptr Wait()
+    {
+        EXPECT_EQ(future.wait_for(5s), std::future_status::ready);
+        return future.get();
+    }
+};
+
+} // namespace
+
+class WriteLimiterTest : public TestFixtureWithContext { };
+
+TEST_F(WriteLimiterTest, QueueBeyondMaxInflightRequests)
+{
+    impl::WriteLimiter limiter(ctx_(), { 2, 0, 0, OverflowPolicy::Fail });
+
+    Outcome outcomes[4];
+    for (auto& outcome : outcomes) { limiter.Submit(10, outcome.Task()); }
+    EXPECT_EQ(outcomes[0].Wait(), nullptr);
+    EXPECT_EQ(outcomes[1].Wait(), nullptr);
+    EXPECT_FALSE(outcomes[2].Ready());
+    EXPECT_FALSE(outcomes[3].Ready());
+
+    auto stats = limiter.Stats();
+    EXPECT_EQ(stats.inflightRequests, 2);
+    EXPECT_EQ(stats.queuedRequests, 2);
+    EXPECT_EQ(stats.inflightBytes, 40);
+
+    limiter.Complete(10);
+    EXPECT_EQ(outcomes[2].Wait(), nullptr);
+    EXPECT_FALSE(outcomes[3].Ready());
+
+    limiter.Complete(10);
+    limiter.Complete(10);
+    EXPECT_EQ(outcomes[3].Wait(), nullptr);
+    limiter.Complete(10);
+
+    stats = limiter.Stats();
+    EXPECT_EQ(stats.inflightRequests, 0);
+    EXPECT_EQ(stats.queuedRequests, 0);
+    EXPECT_EQ(stats.inflightBytes, 0);
+}
+
+TEST_F(WriteLimiterTest, FailWhenQueueIsFull)
+{
+    impl::WriteLimiter limiter(ctx_(), { 1, 1, 0, OverflowPolicy::Fail });
+
+    Outcome outcomes[3];
+    for (auto& outcome : outcomes) { limiter.Submit(10, outcome.Task()); }
+    EXPECT_EQ(outcomes[0].Wait(), nullptr);
+    EXPECT_THROW_AS(std::rethrow_exception(outcomes[2].Wait()),
+                    errc::RuntimeErrors::WriteQueueFull);
+    EXPECT_FALSE(outcomes[1].Ready());
+
+    auto stats = limiter.Stats();
+    EXPECT_EQ(stats.queuedRequests, 1);
+    EXPECT_EQ(stats.inflightBytes, 20);
+    EXPECT_EQ(stats.rejected, 1);
+}
+
+TEST_F(WriteLimiterTest, FailWhenBytesExceed)
+{
+    impl::WriteLimiter limiter(ctx_(), { 0, 0, 100, OverflowPolicy::Fail });
+
+    Outcome first, second, third;
+    limiter.Submit(60, first.Task());
+    limiter.Submit(60, second.Task());
+    EXPECT_EQ(first.Wait(), nullptr);
+    EXPECT_THROW_AS(std::rethrow_exception(second.Wait()),
+                    errc::RuntimeErrors::WriteQueueFull);
+
+    // A write larger than the limit is accepted if nothing else is held.
+    limiter.Complete(60);
+    limiter.Submit(200, third.Task());
+    EXPECT_EQ(third.Wait(), nullptr);
+    EXPECT_EQ(limiter.Stats().inflightBytes, 200);
+}
+
+TEST_F(WriteLimiterTest, DropOldestQueuedWrites)
+{
+    impl::WriteLimiter limiter(ctx_(),
+                               { 1, 2, 0, OverflowPolicy::DropOldest });
+
+    Outcome outcomes[5];
+    for (auto& outcome : outcomes) { limiter.Submit(10, outcome.Task()); }
+    EXPECT_EQ(outcomes[0].Wait(), nullptr);
+    EXPECT_THROW_AS(std::rethrow_exception(outcomes[1].Wait()),
+                    errc::RuntimeErrors::WriteDropped);
+    EXPECT_THROW_AS(std::rethrow_exception(outcomes[2].Wait()),
+                    errc::RuntimeErrors::WriteDropped);
+
+    auto stats = limiter.Stats();
+    EXPECT_EQ(stats.queuedRequests, 2);
+    EXPECT_EQ(stats.dropped, 2);
+
+    limiter.Complete(10);
+    EXPECT_EQ(outcomes[3].Wait(), nullptr);
+}
+
+TEST_F(WriteLimiterTest, DropOldestButStillExceed)
+{
+    impl::WriteLimiter limiter(ctx_(),
+                               { 0, 0, 100, OverflowPolicy::DropOldest });
+
+    // Nothing is queued to be dropped.
+    Outcome first, second;
+    limiter.Submit(60, first.Task());
+    limiter.Submit(60, second.Task());
+    EXPECT_EQ(first.Wait(), nullptr);
+    EXPECT_THROW_AS(std::rethrow_exception(second.Wait()),
+                    errc::RuntimeErrors::WriteQueueFull);
+}
+
+TEST_F(WriteLimiterTest, BlockUntilRoomReleased)
+{
+    impl::WriteLimiter limiter(ctx_(), { 1, 1, 0, OverflowPolicy::Block });
+
+    Outcome first, second, third;
+    limiter.Submit(10, first.Task());
+    limiter.Submit(10, second.Task());
+
+    auto blocked = std::async(std::launch::async, [&] {
+        limiter.Submit(10, third.Task());
+    });
+    EXPECT_EQ(blocked.wait_for(100ms), std::future_status::timeout);
+
+    limiter.Complete(10);
+    EXPECT_EQ(blocked.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(second.Wait(), nullptr);
+    EXPECT_FALSE(third.Ready());
+    EXPECT_EQ(limiter.Stats().queuedRequests, 1);
+}
+
+TEST_F(WriteLimiterTest, NeverBlockThreadsOfClient)
+{
+    impl::WriteLimiter limiter(ctx_(), { 1, 1, 0, OverflowPolicy::Block });
+
+    Outcome first, second, third;
+    limiter.Submit(10, first.Task());
+    limiter.Submit(10, second.Task());
+
+    std::promise<void> submitted;
+    boost::asio::post(ctx_(), [&] {
+        limiter.Submit(10, third.Task());
+        submitted.set_value();
+    });
+    EXPECT_EQ(submitted.get_future().wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(limiter.Stats().queuedRequests, 2);
+}
+
+TEST_F(WriteLimiterTest, StopFailsQueuedWrites)
+{
+    impl::WriteLimiter limiter(ctx_(), { 1, 0, 0, OverflowPolicy::Block });
+
+    Outcome first, second, third;
+    limiter.Submit(10, first.Task());
+    limiter.Submit(10, second.Task());
+    limiter.Stop();
+    EXPECT_THROW_AS(std::rethrow_exception(second.Wait()),
+                    errc::RuntimeErrors::WriteDropped);
+
+    limiter.Submit(10, third.Task());
+    EXPECT_THROW_AS(std::rethrow_exception(third.Wait()),
+                    errc::RuntimeErrors::WriteDropped);
+    EXPECT_EQ(limiter.Stats().rejected, 0);
+    EXPECT_EQ(limiter.Stats().dropped, 2);
+}
+
+} // namespace opengemini::test
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "opengemini/impl/enc/LineProtocolEncoder.hpp"
@@ -21,6 +23,63 @@ using namespace std::chrono_literals;
 
 namespace opengemini::test {
 
+struct Cpu {
+    std::string host;
+    std::string region;
+    double      usage;
+    int64_t     processes;
+    uint64_t    uptime;
+    bool        healthy;
+    std::string state;
+    Point::Time time;
+};
+
+struct Escaped {
+    std::string_view tag;
+    float            value;
+    int32_t          small;
+    uint16_t         smallUnsigned;
+    const char*      text;
+    Point::Time      time;
+};
+
+} // namespace opengemini::test
+
+namespace opengemini {
+
+template<>
+struct Schema<test::Cpu> {
+    static constexpr auto measurement = schema::Measurement("cpu usage");
+    static constexpr auto tags =
+        std::make_tuple(schema::Tag("host", &test::Cpu::host),
+                        schema::Tag("region", &test::Cpu::region));
+    static constexpr auto fields =
+        std::make_tuple(schema::Field("healthy", &test::Cpu::healthy),
+                        schema::Field("processes", &test::Cpu::processes),
+                        schema::Field("state", &test::Cpu::state),
+                        schema::Field("uptime", &test::Cpu::uptime),
+                        schema::Field("usage", &test::Cpu::usage));
+    static constexpr auto time = &test::Cpu::time;
+};
+
+template<>
+struct Schema<test::Escaped> {
+    static constexpr auto measurement = schema::Measurement("m,0");
+    static constexpr auto tags =
+        std::make_tuple(schema::Tag("t=0", &test::Escaped::tag));
+    static constexpr auto fields = std::make_tuple(
+        schema::Field("v 0", &test::Escaped::value),
+        schema::Field("s,0", &test::Escaped::small),
+        schema::Field("u", &test::Escaped::smallUnsigned),
+        schema::Field("x", &test::Escaped::text));
+    static constexpr auto time      = &test::Escaped::time;
+    static constexpr auto precision = Precision::Microsecond;
+};
+
+} // namespace opengemini
+
+namespace opengemini::test {
+
 using namespace opengemini::impl;
 
 TEST(LineProtocolEncoderTest, WithoutEscapedChars)
@@ -167,7 +226,19 @@ TEST(LineProtocolEncoderTest, WithDifferentFieldTypes)
                                                   { { "a", 12.345678901234 } },
                                                   Point::Time{ 1ns },
                                                   { { "T0", "0" } } }),
-              R"(test,T0=0 a=12.3457 1)");
+              R"(test,T0=0 a=12.345678901234 1)");
+
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode({ "test",
+                                                  { { "a", 0.1 + 0.2 } },
+                                                  Point::Time{ 1ns },
+                                                  { { "T0", "0" } } }),
+              R"(test,T0=0 a=0.30000000000000004 1)");
+
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode({ "test",
+                                                  { { "a", -1.5e-300 } },
+                                                  Point::Time{ 1ns },
+                                                  { { "T0", "0" } } }),
+              R"(test,T0=0 a=-1.5e-300 1)");
 
     EXPECT_EQ(enc::LineProtocolEncoder{}.Encode({ "test",
                                                   { { "a", 12345 } },
@@ -259,6 +330,52 @@ TEST(LineProtocolEncoderTest, WithDifferentPrecision)
               "test,T0=0 a=1i 3723004005000");
 }
 
+TEST(LineProtocolEncoderTest, WithTimeUnit)
+{
+    Point point{ "test",
+                 { { "a", 1 } },
+                 Point::Time{ 1h + 2min + 3s + 4ms + 5us + 6ns },
+                 { { "T0", "0" } },
+                 Precision::Hour };
+
+    enc::LineProtocolEncoder encoder;
+    encoder.SetTimeUnit(Precision::Hour);
+    EXPECT_EQ(encoder.Encode(point), "test,T0=0 a=1i 1");
+
+    point.precision = Precision::Second;
+    encoder.SetTimeUnit(Precision::Second);
+    EXPECT_EQ(encoder.Encode(point), "test,T0=0 a=1i 3723");
+
+    // Coarser points are exactly expressed in a finer unit.
+    point.precision = Precision::Minute;
+    encoder.SetTimeUnit(Precision::Millisecond);
+    EXPECT_EQ(encoder.Encode(point), "test,T0=0 a=1i 3720000");
+
+    point.time = Point::Time{ -3s };
+    point.precision = Precision::Second;
+    encoder.SetTimeUnit(Precision::Second);
+    EXPECT_EQ(encoder.Encode(point), "test,T0=0 a=1i -3");
+
+    point.time = Point::Time{};
+    EXPECT_EQ(encoder.Encode(point), "test,T0=0 a=1i");
+}
+
+TEST(LineProtocolEncoderTest, TimeUnitOfPoints)
+{
+    std::vector<Point> points(3, Point{ "test", { { "a", 1 } } });
+    EXPECT_EQ(enc::LineProtocolEncoder::TimeUnitOf({}), Precision::Nanosecond);
+    EXPECT_EQ(enc::LineProtocolEncoder::TimeUnitOf(points),
+              Precision::Nanosecond);
+
+    for (auto& point : points) { point.precision = Precision::Second; }
+    EXPECT_EQ(enc::LineProtocolEncoder::TimeUnitOf(points), Precision::Second);
+
+    points[1].precision = Precision::Hour;
+    points[2].precision = Precision::Millisecond;
+    EXPECT_EQ(enc::LineProtocolEncoder::TimeUnitOf(points),
+              Precision::Millisecond);
+}
+
 TEST(LineProtocolEncoderTest, WithEmptyMeasurement)
 {
     EXPECT_THROW_AS(
@@ -273,6 +390,17 @@ TEST(LineProtocolEncoderTest, WithEmptyFields)
         errc::LogicErrors::InvalidArgument);
 }
 
+TEST(LineProtocolEncoderTest, WithNonFiniteFieldValue)
+{
+    for (auto value : { std::numeric_limits<double>::quiet_NaN(),
+                        std::numeric_limits<double>::infinity(),
+                        -std::numeric_limits<double>::infinity() }) {
+        EXPECT_THROW_AS(enc::LineProtocolEncoder{}.Encode(
+                            Point{ "test", { { "a", value } } }),
+                        errc::LogicErrors::InvalidArgument);
+    }
+}
+
 TEST(LineProtocolEncoderTest, WithMultiFields)
 {
     EXPECT_EQ(
@@ -341,4 +469,283 @@ TEST(LineProtocolEncoderTest, WithMultiPointsActuallyEmpty)
         enc::LineProtocolEncoder{}.Encode(std::vector<Point>{}).empty());
 }
 
+TEST(LineProtocolEncoderTest, WithEscapedCharsInLongStrings)
+{
+    const std::string clean(70, 'x');
+    const auto        tag     = clean + " " + clean + "," + clean + "=";
+    const auto        escaped = clean + "\\ " + clean + "\\," + clean + "\\=";
+    const Point       point{ clean,
+                       { { clean, clean + "\"" } },
+                       Point::Time{},
+                       { { tag, tag } } };
+
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode(point),
+              clean + "," + escaped + "=" + escaped + " " + clean + "=\"" +
+                  clean + "\\\"\"");
+}
+
+TEST(LineProtocolEncoderTest, ReuseBufferAcrossCalls)
+{
+    std::string buffer;
+    buffer.reserve(1024);
+    const auto capacity = buffer.capacity();
+
+    auto content = enc::LineProtocolEncoder{ std::move(buffer) }.Encode(
+        Point{ "test", { { "a", 1 } } });
+    EXPECT_EQ(content, "test a=1i");
+    EXPECT_GE(content.capacity(), capacity);
+
+    enc::LineProtocolEncoder encoder;
+    EXPECT_EQ(encoder.Encode(Point{ "test", { { "a", 1 } } }), "test a=1i");
+    EXPECT_EQ(encoder.Encode(Point{ "test", { { "b", 2 } } }), "test b=2i");
+}
+
+TEST(LineProtocolEncoderTest, WithSeriesCache)
+{
+    const std::vector<Point> points{
+        { "m 1", { { "a", 1 } }, Point::Time{}, { { "t,0", "v=0" } } },
+        { "m 1", { { "a", 2 } }, Point::Time{}, { { "t,0", "v=0" } } },
+        { "m 1", { { "a", 3 } }, Point::Time{}, { { "t,0", "v=1" } } },
+        { "m 1", { { "a", 4 } }, Point::Time{}, { { "t,0", "v=0" } } },
+        { "m 1", { { "a", 5 } }, Point::Time{} },
+        { "m 1", { { "a", 6 } }, Point::Time{} },
+    };
+
+    enc::SeriesCache cache(16);
+    EXPECT_EQ(enc::LineProtocolEncoder{ &cache }.Encode(points),
+              enc::LineProtocolEncoder{}.Encode(points));
+    EXPECT_EQ(cache.Hits(), 3);
+    EXPECT_EQ(cache.Misses(), 3);
+
+    EXPECT_EQ(enc::LineProtocolEncoder{ &cache }.Encode(points[2]),
+              R"(m\ 1,t\,0=v\=1 a=3i)");
+    EXPECT_EQ(cache.Hits(), 4);
+}
+
+TEST(LineProtocolEncoderTest, WithSeriesCacheAndEmptyMeasurement)
+{
+    enc::SeriesCache cache(16);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder{ &cache }.Encode(
+                        Point{ "", { { "a", 1 } } }),
+                    errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder{ &cache }.Encode(
+                        Point{ "", { { "a", 1 } } }),
+                    errc::LogicErrors::InvalidArgument);
+}
+
+namespace {
+
+PointBatch GenerateBatch(std::size_t rows)
+{
+    PointBatch batch{ "cpu usage", {}, {}, { { "host", "a,b" } } };
+    std::vector<double>      user;
+    std::vector<int64_t>     processes;
+    std::vector<uint64_t>    uptime;
+    std::vector<std::string> state;
+    std::vector<bool>        healthy;
+    for (std::size_t idx = 0; idx < rows; ++idx) {
+        user.push_back(static_cast<double>(idx) / 4);
+        processes.push_back(-static_cast<int64_t>(idx));
+        uptime.push_back(idx * 1000);
+        state.push_back(idx % 2 == 0 ? "running" : R"(stop "now")");
+        healthy.push_back(idx % 3 == 0);
+        batch.times.emplace_back(std::chrono::nanoseconds(idx + 1));
+    }
+    batch.fields = { { "user", std::move(user) },
+                     { "processes", std::move(processes) },
+                     { "uptime", std::move(uptime) },
+                     { "state", std::move(state) },
+                     { "healthy", std::move(healthy) } };
+    return batch;
+}
+
+std::vector<Point> ToPoints(const PointBatch& batch)
+{
+    std::vector<Point> points;
+    for (std::size_t row = 0; row < batch.times.size(); ++row) {
+        Point point{ batch.measurement,
+                     {},
+                     batch.times[row],
+                     batch.tags,
+                     batch.precision };
+        for (auto& [key, column] : batch.fields) {
+            std::visit(
+                [&, &key = key](const auto& values) {
+                    point.fields.emplace(key, values[row]);
+                },
+                column);
+        }
+        points.push_back(std::move(point));
+    }
+    return points;
+}
+
+} // namespace
+
+TEST(LineProtocolEncoderTest, WithPointBatch)
+{
+    const auto batch = GenerateBatch(3);
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode(batch),
+              R"(cpu\ usage,host=a\,b healthy=T,processes=0i,state="running",)"
+              R"(uptime=0u,user=0 1)"
+              "\n"
+              R"(cpu\ usage,host=a\,b healthy=F,processes=-1i,)"
+              R"(state="stop \"now\"",uptime=1000u,user=0.25 2)"
+              "\n"
+              R"(cpu\ usage,host=a\,b healthy=F,processes=-2i,state="running",)"
+              R"(uptime=2000u,user=0.5 3)"
+              "\n");
+}
+
+TEST(LineProtocolEncoderTest, WithPointBatchAcrossBlocks)
+{
+    const auto batch = GenerateBatch(2500);
+    const auto expect = enc::LineProtocolEncoder{}.Encode(ToPoints(batch));
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode(batch), expect);
+
+    enc::LineProtocolEncoder encoder;
+    util::ChunkChain         chain;
+    for (std::size_t begin = 0; begin < 2500; begin += 700) {
+        encoder.EncodeTo(
+            batch, begin, std::min<std::size_t>(begin + 700, 2500), chain);
+    }
+    std::string content;
+    for (auto& buffer : chain.Buffers()) {
+        content.append(static_cast<const char*>(buffer.data()), buffer.size());
+    }
+    EXPECT_EQ(content, expect);
+}
+
+TEST(LineProtocolEncoderTest, WithPointBatchActuallyEmpty)
+{
+    const auto batch = GenerateBatch(0);
+    EXPECT_TRUE(enc::LineProtocolEncoder{}.Encode(batch).empty());
+}
+
+TEST(LineProtocolEncoderTest, WithInvalidPointBatch)
+{
+    auto batch = GenerateBatch(3);
+    batch.times.pop_back();
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::Validate(batch),
+                    errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder{}.Encode(batch),
+                    errc::LogicErrors::InvalidArgument);
+
+    batch = GenerateBatch(3);
+    batch.fields.clear();
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::Validate(batch),
+                    errc::LogicErrors::InvalidArgument);
+
+    batch = GenerateBatch(3);
+    batch.measurement.clear();
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::Validate(batch),
+                    errc::LogicErrors::InvalidArgument);
+
+    batch = GenerateBatch(3);
+    std::get<std::vector<double>>(batch.fields["user"])[1] =
+        std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::Validate(batch),
+                    errc::LogicErrors::InvalidArgument);
+}
+
+TEST(LineProtocolEncoderTest, WithSchema)
+{
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode(
+                  Escaped{ "a b", 0.5f, -3, 7, R"(say "hi")", Point::Time{} }),
+              R"(m\,0,t\=0=a\ b v\ 0=0.5,s\,0=-3i,u=7u,x="say \"hi\"")");
+
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode(
+                  Escaped{ "", 1, 0, 0, "", Point::Time{ 1500ns } }),
+              R"(m\,0,t\=0= v\ 0=1,s\,0=0i,u=0u,x="" 2000)");
+}
+
+TEST(LineProtocolEncoderTest, WithSchemaSameAsPoints)
+{
+    std::vector<Cpu>   records;
+    std::vector<Point> points;
+    for (int64_t idx = 0; idx < 100; ++idx) {
+        records.push_back({ "server-" + std::to_string(idx % 7),
+                            "cn north",
+                            static_cast<double>(idx) / 3,
+                            idx * 31,
+                            static_cast<uint64_t>(idx) * 1000,
+                            idx % 2 == 0,
+                            "running, \"ok\"",
+                            Point::Time{ std::chrono::seconds(idx) } });
+        auto& record = records.back();
+        points.push_back({ "cpu usage",
+                           { { "usage", record.usage },
+                             { "processes", record.processes },
+                             { "uptime", record.uptime },
+                             { "healthy", record.healthy },
+                             { "state", record.state } },
+                           record.time,
+                           { { "host", record.host },
+                             { "region", record.region } } });
+    }
+
+    const auto expect = enc::LineProtocolEncoder{}.Encode(points);
+    EXPECT_EQ(enc::LineProtocolEncoder{}.Encode(records), expect);
+
+    enc::LineProtocolEncoder encoder;
+    util::ChunkChain         chain;
+    for (auto& record : records) { encoder.EncodeTo(record, chain); }
+    std::string content;
+    for (auto& buffer : chain.Buffers()) {
+        content.append(static_cast<const char*>(buffer.data()), buffer.size());
+    }
+    EXPECT_EQ(content, expect);
+}
+
+TEST(LineProtocolEncoderTest, WithSchemaAndInvalidFloat)
+{
+    Cpu record{ "a", "b", 0, 0, 0, true, "", Point::Time{} };
+    EXPECT_NO_THROW(enc::LineProtocolEncoder::Validate(record));
+
+    record.usage = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::Validate(record),
+                    errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder{}.Encode(record),
+                    errc::LogicErrors::InvalidArgument);
+
+    Escaped escaped{ "", std::numeric_limits<float>::infinity(), 0, 0, "", {} };
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::Validate(escaped),
+                    errc::LogicErrors::InvalidArgument);
+}
+
+TEST(LineProtocolEncoderTest, ValidateRaw)
+{
+    using Buffers = std::vector<std::string_view>;
+
+    EXPECT_NO_THROW(enc::LineProtocolEncoder::ValidateRaw({}));
+    EXPECT_NO_THROW(enc::LineProtocolEncoder::ValidateRaw(
+        { "m,t=1 f=1 1\n\n# comment\nm f=2" }));
+    EXPECT_NO_THROW(enc::LineProtocolEncoder::ValidateRaw(
+        Buffers{ "m,t=1", " f=1\nm", "", " f=2\n" }));
+
+    EXPECT_THROW_AS(
+        enc::LineProtocolEncoder::ValidateRaw({ "m f=1\n,t=1 f=1" }),
+        errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::ValidateRaw({ "m f=1\nm\n" }),
+                    errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(
+        enc::LineProtocolEncoder::ValidateRaw(Buffers{ "m f=1\nm,t=1", "\n" }),
+        errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::ValidateRaw({ "m" }),
+                    errc::LogicErrors::InvalidArgument);
+
+    // Escaped spaces do not separate the field set.
+    EXPECT_NO_THROW(enc::LineProtocolEncoder::ValidateRaw(
+        { "m\\ 1,t=a\\ b f\\ 1=1\n" }));
+    EXPECT_NO_THROW(enc::LineProtocolEncoder::ValidateRaw(
+        Buffers{ "m\\", "  f=1" }));
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::ValidateRaw({ "m\\ f=1" }),
+                    errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(
+        enc::LineProtocolEncoder::ValidateRaw(Buffers{ "m\\", " f=1" }),
+        errc::LogicErrors::InvalidArgument);
+    EXPECT_THROW_AS(enc::LineProtocolEncoder::ValidateRaw({ "m f 1" }),
+                    errc::LogicErrors::InvalidArgument);
+}
+
 } // namespace opengemini::test
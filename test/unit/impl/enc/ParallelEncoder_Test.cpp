@@ -0,0 +1,102 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/enc/LineProtocolEncoder.hpp"
+#include "opengemini/impl/enc/ParallelEncoder.hpp"
+#include "test/BodySource.hpp"
+#include "test/ExpectThrowAs.hpp"
+#include "test/TestFixtureWithContext.hpp"
+
+namespace opengemini::test {
+
+using namespace std::chrono_literals;
+
+class ParallelEncoderTestFixture : public TestFixtureWithContext {
+protected:
+    ParallelEncoderTestFixture() : TestFixtureWithContext(4) { }
+
+    std::string DoEncode(const impl::enc::ParallelEncoder& encoder,
+                         const std::vector<Point>&         points)
+    {
+        return boost::asio::spawn(
+                   ctx_(),
+                   [&](auto yield) {
+                       impl::http::ChainBodySource source(encoder.Encode(
+                           points, Precision::Nanosecond, nullptr, yield));
+                       return ReadBodySource(source);
+                   },
+                   boost::asio::use_future)
+            .get();
+    }
+
+    static std::vector<Point> GeneratePoints(std::size_t count)
+    {
+        std::vector<Point> points;
+        points.reserve(count);
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            points.push_back({ "test",
+                               { { "a", static_cast<int64_t>(idx) } },
+                               Point::Time{ 1ns },
+                               { { "T0", std::to_string(idx % 7) } } });
+        }
+        return points;
+    }
+};
+
+TEST_F(ParallelEncoderTestFixture, AcceptOnlyLargeEnoughPoints)
+{
+    const auto points = GeneratePoints(100);
+
+    EXPECT_TRUE(impl::enc::ParallelEncoder(ctx_(), 100, 4).Accept(points));
+    EXPECT_FALSE(impl::enc::ParallelEncoder(ctx_(), 101, 4).Accept(points));
+    EXPECT_FALSE(impl::enc::ParallelEncoder(ctx_(), 0, 4).Accept(points));
+    EXPECT_FALSE(impl::enc::ParallelEncoder(ctx_(), 100, 1).Accept(points));
+}
+
+TEST_F(ParallelEncoderTestFixture, KeepOrderOfPoints)
+{
+    for (auto count : { 1, 3, 4, 5, 1000, 100003 }) {
+        const auto points = GeneratePoints(count);
+        const auto expect = impl::enc::LineProtocolEncoder{}.Encode(points);
+
+        impl::enc::ParallelEncoder encoder(ctx_(), 1, 4);
+        EXPECT_EQ(DoEncode(encoder, points), expect);
+    }
+}
+
+TEST_F(ParallelEncoderTestFixture, MoreSlicesThanThreads)
+{
+    const auto points = GeneratePoints(10000);
+    const auto expect = impl::enc::LineProtocolEncoder{}.Encode(points);
+
+    impl::enc::ParallelEncoder encoder(ctx_(), 1, 64);
+    EXPECT_EQ(DoEncode(encoder, points), expect);
+}
+
+TEST_F(ParallelEncoderTestFixture, WithInvalidPoint)
+{
+    auto points = GeneratePoints(10000);
+    points[7777].fields.emplace("b", std::numeric_limits<double>::infinity());
+
+    impl::enc::ParallelEncoder encoder(ctx_(), 1, 4);
+    EXPECT_THROW_AS(DoEncode(encoder, points),
+                    errc::LogicErrors::InvalidArgument);
+}
+
+} // namespace opengemini::test
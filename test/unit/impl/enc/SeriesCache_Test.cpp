@@ -0,0 +1,97 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/enc/SeriesCache.hpp"
+
+namespace opengemini::test {
+
+using namespace opengemini::impl;
+
+TEST(SeriesCacheTest, LookupAfterInsert)
+{
+    enc::SeriesCache cache(16);
+    std::string      out{ "head:" };
+
+    EXPECT_FALSE(cache.Lookup("key", out));
+    cache.Insert("key", "prefix");
+    EXPECT_TRUE(cache.Lookup("key", out));
+    EXPECT_EQ(out, "head:prefix");
+
+    EXPECT_EQ(cache.Hits(), 1);
+    EXPECT_EQ(cache.Misses(), 1);
+}
+
+TEST(SeriesCacheTest, InsertExistingKey)
+{
+    enc::SeriesCache cache(16);
+    cache.Insert("key", "first");
+    cache.Insert("key", "second");
+
+    std::string out;
+    EXPECT_TRUE(cache.Lookup("key", out));
+    EXPECT_EQ(out, "first");
+}
+
+TEST(SeriesCacheTest, BoundedByCapacity)
+{
+    constexpr std::size_t capacity{ 64 };
+    constexpr std::size_t count{ 10000 };
+
+    enc::SeriesCache cache(capacity);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        cache.Insert(std::to_string(idx), std::to_string(idx));
+    }
+
+    std::size_t cached{ 0 };
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        std::string out;
+        if (cache.Lookup(std::to_string(idx), out)) {
+            EXPECT_EQ(out, std::to_string(idx));
+            ++cached;
+        }
+    }
+    EXPECT_GT(cached, 0);
+    EXPECT_LE(cached, capacity);
+}
+
+TEST(SeriesCacheTest, CallFromMultiThreads)
+{
+    enc::SeriesCache cache(128);
+
+    std::vector<std::thread> threads;
+    for (auto thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&cache] {
+            for (std::size_t idx = 0; idx < 10000; ++idx) {
+                auto        key = std::to_string(idx % 256);
+                std::string out;
+                if (cache.Lookup(key, out)) { EXPECT_EQ(out, key); }
+                else {
+                    cache.Insert(key, key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(cache.Hits() + cache.Misses(), 40000);
+}
+
+} // namespace opengemini::test
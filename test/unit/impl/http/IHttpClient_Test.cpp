@@ -25,6 +25,10 @@
 #    include "test/SelfRootCA.hpp"
 #endif // OPENGEMINI_ENABLE_SSL_SUPPORT
 #include "opengemini/Exception.hpp"
+#include "opengemini/impl/util/Gzip.hpp"
+#include "test/BodySource.hpp"
+#include "test/ExpectThrowAs.hpp"
+#include "test/MockIHttpClient.hpp"
 #include "test/Random.hpp"
 #include "test/TestFixtureWithContext.hpp"
 
@@ -187,6 +191,187 @@ TEST_F(IHttpClientTestFixture, ReadWriteTimeout)
     }
 }
 
+TEST_F(IHttpClientTestFixture, GzipResponse)
+{
+    for (auto& [client, endpoint] : clients_) {
+        client->EnableGzip({});
+
+        auto rsp = DoGet(client, endpoint, "/gzip");
+        EXPECT_EQ(rsp.result_int(), 200);
+        EXPECT_THAT(rsp.body(), testing::HasSubstr(R"("gzipped": true)"));
+    }
+}
+
+TEST_F(IHttpClientTestFixture, CompressRequestBodyWithGzip)
+{
+    using boost::beast::http::field;
+
+    auto                 mockHttp = std::make_unique<MockIHttpClient>(ctx_());
+    std::vector<Request> requests;
+    EXPECT_CALL(*mockHttp, SendRequest(testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(
+            [&requests](const Endpoint&, Request request, auto) {
+                requests.push_back(std::move(request));
+                return Response{ Status::no_content, 11 };
+            });
+    mockHttp->EnableGzip({ 6, 64 });
+
+    std::unique_ptr<IHttpClient> client = std::move(mockHttp);
+    const auto small = GenerateRandomString(63);
+    const auto large = GenerateRandomString(4096);
+    DoPost(client, Endpoint{ "127.0.0.1", 8086 }, "/write", small);
+    DoPost(client, Endpoint{ "127.0.0.1", 8086 }, "/write", large);
+
+    ASSERT_EQ(requests.size(), 2);
+    EXPECT_EQ(requests[0][field::accept_encoding], "gzip");
+    EXPECT_EQ(requests[0].count(field::content_encoding), 0);
+    EXPECT_EQ(requests[0].body(), small);
+
+    EXPECT_EQ(requests[1][field::accept_encoding], "gzip");
+    EXPECT_EQ(requests[1][field::content_encoding], "gzip");
+    EXPECT_EQ(requests[1][field::content_length],
+              std::to_string(requests[1].body().size()));
+
+    std::string        inflated;
+    util::GzipInflater inflater;
+    EXPECT_TRUE(inflater.Inflate(requests[1].body().data(),
+                                 requests[1].body().size(),
+                                 inflated));
+    EXPECT_TRUE(inflater.Done());
+    EXPECT_EQ(inflated, large);
+}
+
+TEST_F(IHttpClientTestFixture, CompressStreamingBodyWithGzip)
+{
+    using boost::beast::http::field;
+
+    auto mockHttp = std::make_unique<MockIHttpClient>(ctx_());
+
+    std::vector<StreamRequest> requests;
+    EXPECT_CALL(*mockHttp,
+                SendStreamRequest(testing::_, testing::_, testing::_))
+        .WillOnce([&requests](const Endpoint&, StreamRequest request, auto) {
+            requests.push_back(std::move(request));
+            return Response{ Status::no_content, 11 };
+        });
+    mockHttp->EnableGzip({ 6, 1024 * 1024 });
+
+    std::unique_ptr<IHttpClient> client  = std::move(mockHttp);
+    const auto                   content = GenerateRandomString(63);
+    DoPost(client,
+           Endpoint{ "127.0.0.1", 8086 },
+           "/write",
+           std::make_shared<StringBodySource>(content, 10));
+
+    ASSERT_EQ(requests.size(), 1);
+    EXPECT_TRUE(requests[0].chunked());
+    EXPECT_EQ(requests[0][field::accept_encoding], "gzip");
+    EXPECT_EQ(requests[0][field::content_encoding], "gzip");
+
+    auto               compressed = ReadBodySource(*requests[0].body());
+    std::string        inflated;
+    util::GzipInflater inflater;
+    EXPECT_TRUE(
+        inflater.Inflate(compressed.data(), compressed.size(), inflated));
+    EXPECT_TRUE(inflater.Done());
+    EXPECT_EQ(inflated, content);
+}
+
+TEST_F(IHttpClientTestFixture, EnableGzipWithInvalidLevel)
+{
+    for (auto& [client, _] : clients_) {
+        EXPECT_THROW_AS(client->EnableGzip({ 10, 0 }),
+                        errc::LogicErrors::InvalidArgument);
+        EXPECT_THROW_AS(client->EnableGzip({ -2, 0 }),
+                        errc::LogicErrors::InvalidArgument);
+    }
+}
+
+void ParseInChunks(
+    boost::beast::http::response_parser<InflatingStringBody>& parser,
+    std::string_view                                          message,
+    std::size_t                                               chunkSize,
+    boost::beast::error_code&                                 error)
+{
+    for (std::size_t pos = 0; pos < message.size() && !parser.is_done();) {
+        auto size = std::min(chunkSize, message.size() - pos);
+        pos += parser.put(boost::asio::buffer(message.data() + pos, size),
+                          error);
+        if (error == boost::beast::http::error::need_more) { error = {}; }
+        if (error) { return; }
+    }
+}
+
+TEST(InflatingStringBodyTest, InflateGzipEncodedBody)
+{
+    const auto body       = GenerateRandomString(100000);
+    const auto compressed = util::GzipCompress(body, 6);
+    const auto message =
+        fmt::format("HTTP/1.1 200 OK\r\n"
+                    "Content-Encoding: gzip\r\n"
+                    "Content-Length: {}\r\n\r\n{}",
+                    compressed.size(),
+                    compressed);
+
+    boost::beast::http::response_parser<InflatingStringBody> parser;
+    boost::beast::error_code                                  error;
+    ParseInChunks(parser, message, 1000, error);
+
+    EXPECT_FALSE(error);
+    EXPECT_TRUE(parser.is_done());
+    EXPECT_EQ(parser.get().body(), body);
+    EXPECT_EQ(parser.get().count(boost::beast::http::field::content_encoding),
+              0);
+}
+
+TEST(InflatingStringBodyTest, RejectGzipBodyInflatedBeyondLimit)
+{
+    const auto compressed = util::GzipCompress(
+        std::string(InflatingStringBody::bodyLimit + 1, 'a'),
+        9);
+    const auto message =
+        fmt::format("HTTP/1.1 200 OK\r\n"
+                    "Content-Encoding: gzip\r\n"
+                    "Content-Length: {}\r\n\r\n{}",
+                    compressed.size(),
+                    compressed);
+
+    boost::beast::http::response_parser<InflatingStringBody> parser;
+    boost::beast::error_code                                  error;
+    ParseInChunks(parser, message, 1000, error);
+
+    EXPECT_EQ(error, boost::beast::http::error::body_limit);
+    EXPECT_LE(parser.get().body().size(), InflatingStringBody::bodyLimit);
+}
+
+TEST(InflatingStringBodyTest, KeepPlainBody)
+{
+    const auto message = "HTTP/1.1 200 OK\r\n"
+                         "Content-Length: 5\r\n\r\nhello";
+
+    boost::beast::http::response_parser<InflatingStringBody> parser;
+    boost::beast::error_code                                  error;
+    ParseInChunks(parser, message, std::strlen(message), error);
+
+    EXPECT_FALSE(error);
+    EXPECT_TRUE(parser.is_done());
+    EXPECT_EQ(parser.get().body(), "hello");
+}
+
+TEST(InflatingStringBodyTest, RejectCorruptedGzipBody)
+{
+    const auto message = "HTTP/1.1 200 OK\r\n"
+                         "Content-Encoding: gzip\r\n"
+                         "Content-Length: 5\r\n\r\nhello";
+
+    boost::beast::http::response_parser<InflatingStringBody> parser;
+    boost::beast::error_code                                  error;
+    ParseInChunks(parser, message, std::strlen(message), error);
+
+    EXPECT_TRUE(error);
+}
+
 #ifdef OPENGEMINI_ENABLE_SSL_SUPPORT
 
 TEST_F(IHttpClientTestFixture, WithInvalidRootCA)
@@ -0,0 +1,230 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/http/IHttpClient.hpp"
+#include "opengemini/impl/http/StreamingBody.hpp"
+#include "opengemini/impl/util/Gzip.hpp"
+#include "test/Random.hpp"
+#include "test/BodySource.hpp"
+
+namespace opengemini::test {
+
+using namespace impl::http;
+
+namespace {
+
+std::string Serialize(const StreamRequest& request)
+{
+    std::ostringstream os;
+    os << request;
+    return os.str();
+}
+
+std::string ParseBody(const std::string& message)
+{
+    boost::beast::http::request_parser<boost::beast::http::string_body> parser;
+    boost::beast::error_code                                             error;
+    parser.eager(true);
+    parser.put(boost::asio::buffer(message), error);
+    EXPECT_FALSE(error);
+    EXPECT_TRUE(parser.is_done());
+    return parser.get().body();
+}
+
+} // namespace
+
+TEST(ChunkChainTest, AppendAcrossChunks)
+{
+    const auto content =
+        GenerateRandomString(2 * util::ChunkPool::CHUNK_SIZE + 100);
+
+    util::ChunkChain chain;
+    chain.Append(std::string_view(content).substr(0, 100));
+    chain.Append(std::string_view(content).substr(100));
+
+    EXPECT_EQ(chain.Size(), content.size());
+    EXPECT_EQ(chain.Buffers().size(), 3);
+    EXPECT_EQ(boost::beast::buffers_to_string(chain.Buffers()), content);
+
+    chain.Clear();
+    EXPECT_TRUE(chain.Empty());
+    EXPECT_TRUE(chain.Buffers().empty());
+}
+
+TEST(ChunkChainTest, AppendAnotherChain)
+{
+    const auto content = GenerateRandomString(util::ChunkPool::CHUNK_SIZE + 1);
+
+    util::ChunkChain chain, other;
+    chain.Append("head");
+    other.Append(content);
+    chain.Append(std::move(other));
+    chain.Append("tail");
+
+    EXPECT_TRUE(other.Empty());
+    EXPECT_EQ(chain.Size(), content.size() + 8);
+    EXPECT_EQ(boost::beast::buffers_to_string(chain.Buffers()),
+              "head" + content + "tail");
+}
+
+TEST(ChunkChainTest, BorrowWithoutCopying)
+{
+    const std::string borrowed("borrowed");
+
+    util::ChunkChain chain;
+    chain.Append("head");
+    chain.Borrow(borrowed);
+    chain.Borrow({});
+    chain.Append("tail");
+
+    auto buffers = chain.Buffers();
+    ASSERT_EQ(buffers.size(), 3);
+    EXPECT_EQ(buffers[1].data(), borrowed.data());
+    EXPECT_EQ(chain.Size(), 16);
+    EXPECT_EQ(boost::beast::buffers_to_string(buffers), "headborrowedtail");
+
+    chain.Clear();
+    EXPECT_TRUE(chain.Empty());
+}
+
+TEST(ChunkChainTest, OwnBorrowedData)
+{
+    std::string borrowed("borrowed");
+
+    util::ChunkChain chain;
+    chain.Append("head");
+    chain.Borrow(borrowed);
+    chain.Append("tail");
+    chain.Own();
+    borrowed.assign(borrowed.size(), 'x');
+
+    auto buffers = chain.Buffers();
+    for (auto& buffer : buffers) { EXPECT_NE(buffer.data(), borrowed.data()); }
+    EXPECT_EQ(chain.Size(), 16);
+    EXPECT_EQ(boost::beast::buffers_to_string(buffers), "headborrowedtail");
+}
+
+TEST(ChunkChainTest, MoveLeavesSourceEmpty)
+{
+    util::ChunkChain chain;
+    chain.Append("moved");
+
+    util::ChunkChain moved(std::move(chain));
+    EXPECT_TRUE(chain.Empty());
+    EXPECT_TRUE(chain.Buffers().empty());
+    EXPECT_EQ(boost::beast::buffers_to_string(moved.Buffers()), "moved");
+
+    util::ChunkChain other;
+    other.Append("other");
+    auto released = other.Buffers().front().data();
+    other         = std::move(moved);
+    EXPECT_TRUE(moved.Empty());
+    EXPECT_TRUE(moved.Buffers().empty());
+    EXPECT_EQ(other.Size(), 5);
+    EXPECT_EQ(boost::beast::buffers_to_string(other.Buffers()), "moved");
+
+    // The chunk replaced by the assignment went back to the pool.
+    util::ChunkChain next;
+    next.Append("next");
+    EXPECT_EQ(next.Buffers().front().data(), released);
+}
+
+TEST(StreamingBodyTest, SendEncodedChain)
+{
+    const auto content =
+        GenerateRandomString(3 * util::ChunkPool::CHUNK_SIZE + 10);
+
+    util::ChunkChain chain;
+    chain.Append(content);
+
+    StreamRequest request{ boost::beast::http::verb::post, "/write", 11 };
+    request.body() = std::make_shared<ChainBodySource>(std::move(chain));
+    request.chunked(true);
+
+    // Sending the same request twice replays the whole body.
+    EXPECT_EQ(ParseBody(Serialize(request)), content);
+    EXPECT_EQ(ParseBody(Serialize(request)), content);
+}
+
+TEST(StreamingBodyTest, ProduceSharedChainWithoutCopying)
+{
+    const auto content = GenerateRandomString(util::ChunkPool::CHUNK_SIZE + 1);
+
+    auto shared = std::make_shared<util::ChunkChain>();
+    shared->Append(content);
+    ChainBodySource source(shared);
+
+    util::ChunkChain chain;
+    source.Rewind();
+    while (source.Produce(chain)) { }
+
+    auto expect = shared->Buffers();
+    auto actual = chain.Buffers();
+    ASSERT_EQ(actual.size(), expect.size());
+    for (std::size_t idx = 0; idx < actual.size(); ++idx) {
+        EXPECT_EQ(actual[idx].data(), expect[idx].data());
+    }
+    EXPECT_EQ(boost::beast::buffers_to_string(actual), content);
+}
+
+TEST(StreamingBodyTest, SendWithChunkedTransferEncoding)
+{
+    const auto content = GenerateRandomString(1000000);
+    auto       source  = std::make_shared<StringBodySource>(content, 10000);
+
+    StreamRequest request{ boost::beast::http::verb::post, "/write", 11 };
+    request.body() = source;
+    request.chunked(true);
+
+    auto message = Serialize(request);
+    EXPECT_NE(message.find("Transfer-Encoding: chunked"), message.npos);
+    EXPECT_EQ(ParseBody(message), content);
+
+    // Sending the request again, e.g. on retry, starts over from the beginning.
+    EXPECT_EQ(ParseBody(Serialize(request)), content);
+    EXPECT_EQ(source->Rewinds(), 2);
+}
+
+TEST(StreamingBodyTest, SendEmptyBody)
+{
+    StreamRequest request{ boost::beast::http::verb::post, "/write", 11 };
+    request.body() = std::make_shared<StringBodySource>("", 10);
+    request.chunked(true);
+
+    EXPECT_EQ(ParseBody(Serialize(request)), "");
+}
+
+TEST(StreamingBodyTest, CompressWithGzip)
+{
+    const auto content = GenerateRandomString(300000);
+
+    GzipBodySource source(std::make_shared<StringBodySource>(content, 7000),
+                          6);
+    for (auto round = 0; round < 2; ++round) {
+        auto compressed = ReadBodySource(source);
+
+        std::string        inflated;
+        util::GzipInflater inflater;
+        EXPECT_TRUE(
+            inflater.Inflate(compressed.data(), compressed.size(), inflated));
+        EXPECT_TRUE(inflater.Done());
+        EXPECT_EQ(inflated, content);
+    }
+}
+
+} // namespace opengemini::test
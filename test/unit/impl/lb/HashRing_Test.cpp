@@ -0,0 +1,95 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/lb/HashRing.hpp"
+#include "opengemini/impl/util/Hash.hpp"
+
+namespace opengemini::test {
+
+using namespace opengemini::impl;
+
+namespace {
+
+const std::vector<Endpoint> endpoints{
+    { "host1", 8086 },
+    { "host2", 8086 },
+    { "host3", 8086 },
+    { "host4", 8086 },
+};
+
+constexpr std::uint64_t KEYS{ 10000 };
+
+auto AcceptAll = [](std::size_t) { return true; };
+
+} // namespace
+
+TEST(HashRingTest, SpreadKeysOverServers)
+{
+    lb::HashRing ring(endpoints);
+
+    std::vector<std::size_t> counts(endpoints.size());
+    for (std::uint64_t key = 0; key < KEYS; ++key) {
+        auto idx = ring.Locate(util::Mix64(key), AcceptAll);
+        ASSERT_TRUE(idx.has_value());
+        ++counts[idx.value()];
+    }
+    for (auto count : counts) {
+        EXPECT_GT(count, KEYS / endpoints.size() / 2);
+        EXPECT_LT(count, KEYS / endpoints.size() * 2);
+    }
+}
+
+TEST(HashRingTest, MoveOnlyKeysOfSkippedServer)
+{
+    lb::HashRing ring(endpoints);
+
+    for (std::uint64_t key = 0; key < KEYS; ++key) {
+        auto hash   = util::Mix64(key);
+        auto before = ring.Locate(hash, AcceptAll).value();
+        auto after  = ring.Locate(hash, [](std::size_t idx) {
+                              return idx != 1;
+                          }).value();
+        if (before == 1) { EXPECT_NE(after, 1); }
+        else {
+            EXPECT_EQ(after, before);
+        }
+    }
+}
+
+TEST(HashRingTest, IndependentOfEndpointsOrder)
+{
+    lb::HashRing ring(endpoints);
+    lb::HashRing reversed({ endpoints.rbegin(), endpoints.rend() });
+
+    for (std::uint64_t key = 0; key < KEYS; ++key) {
+        auto hash = util::Mix64(key);
+        auto idx  = reversed.Locate(hash, AcceptAll).value();
+        EXPECT_EQ(endpoints.size() - 1 - idx,
+                  ring.Locate(hash, AcceptAll).value());
+    }
+}
+
+TEST(HashRingTest, NoServerAccepted)
+{
+    lb::HashRing ring(endpoints);
+    EXPECT_FALSE(
+        ring.Locate(0, [](std::size_t) { return false; }).has_value());
+}
+
+} // namespace opengemini::test
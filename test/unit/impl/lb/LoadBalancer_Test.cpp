@@ -92,6 +92,19 @@ TEST_F(LoadBalancerTestFixture, PickAllServers)
     }
 }
 
+TEST_F(LoadBalancerTestFixture, PickServerOfKey)
+{
+    auto lb = lb::LoadBalancer::Construct(ctx_(), endpoints_, nullptr);
+
+    std::unordered_set<Endpoint, Endpoint::Hasher> picked;
+    for (std::uint64_t key = 0; key < 1000; ++key) {
+        auto& endpoint = lb->PickServerOf(key * 0x9E3779B97F4A7C15ULL);
+        EXPECT_EQ(lb->PickServerOf(key * 0x9E3779B97F4A7C15ULL), endpoint);
+        picked.insert(endpoint);
+    }
+    EXPECT_GT(picked.size(), 1);
+}
+
 TEST_F(LoadBalancerTestFixture, HealthCheckAllAvailable)
 {
     auto mockHttp = std::make_shared<MockIHttpClient>(ctx_());
@@ -122,6 +135,8 @@ TEST_F(LoadBalancerTestFixture, HealthCheckAllUnavailable)
 
     EXPECT_THROW_AS(lb->PickAvailableServer(),
                     errc::ServerErrors::NoAvailableServer);
+    EXPECT_THROW_AS(lb->PickServerOf(0),
+                    errc::ServerErrors::NoAvailableServer);
 }
 
 TEST_F(LoadBalancerTestFixture, HealthCheckPartiallyAvailable)
@@ -0,0 +1,288 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/spill/SpillQueue.hpp"
+#include "test/ExpectThrowAs.hpp"
+#include "test/TestFixtureWithContext.hpp"
+
+namespace opengemini::test {
+
+using namespace std::chrono_literals;
+using impl::spill::SpillQueue;
+
+class SpillQueueTest : public TestFixtureWithContext {
+protected:
+    SpillQueueTest() :
+        directory_(std::filesystem::temp_directory_path() /
+                   ("opengemini_spill_" +
+                    std::string(testing::UnitTest::GetInstance()
+                                    ->current_test_info()
+                                    ->name())))
+    {
+        std::filesystem::remove_all(directory_);
+        config_.directory = directory_.string();
+    }
+
+    ~SpillQueueTest() { std::filesystem::remove_all(directory_); }
+
+    std::shared_ptr<SpillQueue> Construct(SpillQueue::Sender sender = {})
+    {
+        return SpillQueue::Construct(ctx_(), config_, std::move(sender), 10ms);
+    }
+
+    std::size_t Segments() const
+    {
+        std::size_t count{ 0 };
+        for (auto& entry : std::filesystem::directory_iterator(directory_)) {
+            count += entry.path().extension() == ".seg";
+        }
+        return count;
+    }
+
+    static void ExpectFront(SpillQueue&      queue,
+                            std::string_view database,
+                            std::string_view retentionPolicy,
+                            std::string_view body)
+    {
+        auto entry = queue.Front();
+        ASSERT_TRUE(entry.has_value());
+        EXPECT_EQ(entry->database, database);
+        EXPECT_EQ(entry->retentionPolicy, retentionPolicy);
+        EXPECT_EQ(entry->body, body);
+        queue.Pop();
+    }
+
+protected:
+    std::filesystem::path directory_;
+    SpillConfig           config_;
+};
+
+TEST_F(SpillQueueTest, FirstInFirstOut)
+{
+    auto queue = Construct();
+    EXPECT_FALSE(queue->Front().has_value());
+
+    queue->Append("db0", "rp0", "m0 f=1");
+    queue->Append("db1", "", "m1 f=2\nm1 f=3");
+    queue->Append("db2", "rp2", "");
+    EXPECT_EQ(queue->DiskBytes(), std::filesystem::file_size(
+                                      directory_ / "00000000000000000000.seg"));
+
+    ExpectFront(*queue, "db0", "rp0", "m0 f=1");
+    ExpectFront(*queue, "db1", "", "m1 f=2\nm1 f=3");
+    queue->Append("db3", "rp3", "m3 f=4");
+    ExpectFront(*queue, "db2", "rp2", "");
+    ExpectFront(*queue, "db3", "rp3", "m3 f=4");
+    EXPECT_FALSE(queue->Front().has_value());
+
+    EXPECT_EQ(queue->DiskBytes(), 0);
+    EXPECT_EQ(Segments(), 0);
+}
+
+TEST_F(SpillQueueTest, KeepPrecisionOfWrites)
+{
+    {
+        auto queue = Construct();
+        queue->Append("db", "rp", "m f=1 1", Precision::Second);
+        queue->Append("db", "rp", "m f=2 2");
+    }
+
+    auto queue = Construct();
+    auto entry = queue->Front();
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->precision, Precision::Second);
+    EXPECT_EQ(entry->body, "m f=1 1");
+    queue->Pop();
+
+    entry = queue->Front();
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->precision, Precision::Nanosecond);
+    EXPECT_EQ(entry->body, "m f=2 2");
+}
+
+TEST_F(SpillQueueTest, RemoveSegmentsOnceReplayed)
+{
+    config_.segmentBytes = 64;
+    auto queue           = Construct();
+    for (auto idx = 0; idx < 10; ++idx) {
+        queue->Append("db",
+                      "rp",
+                      "m f=" + std::to_string(idx) + std::string(20, 'x'));
+    }
+    EXPECT_EQ(Segments(), 10);
+
+    for (auto idx = 0; idx < 10; ++idx) {
+        ExpectFront(*queue,
+                    "db",
+                    "rp",
+                    "m f=" + std::to_string(idx) + std::string(20, 'x'));
+        EXPECT_EQ(Segments(), 9 - idx);
+    }
+}
+
+TEST_F(SpillQueueTest, FailBeyondMaxDiskBytes)
+{
+    config_.maxDiskBytes = 72;
+    auto queue           = Construct();
+    queue->Append("db", "rp", std::string(40, 'x'));
+    EXPECT_THROW_AS(queue->Append("db", "rp", std::string(40, 'x')),
+                    errc::RuntimeErrors::SpillFailed);
+
+    ExpectFront(*queue, "db", "rp", std::string(40, 'x'));
+    queue->Append("db", "rp", std::string(40, 'x'));
+}
+
+TEST_F(SpillQueueTest, ResumeFromCheckpoint)
+{
+    config_.segmentBytes = 64;
+    {
+        auto queue = Construct();
+        for (auto idx = 0; idx < 5; ++idx) {
+            queue->Append("db", "rp", std::string(20, 'a' + idx));
+        }
+        ExpectFront(*queue, "db", "rp", std::string(20, 'a'));
+        ExpectFront(*queue, "db", "rp", std::string(20, 'b'));
+    }
+
+    auto queue = Construct();
+    queue->Append("db", "rp", std::string(20, 'f'));
+    for (auto idx = 2; idx < 6; ++idx) {
+        ExpectFront(*queue, "db", "rp", std::string(20, 'a' + idx));
+    }
+    EXPECT_FALSE(queue->Front().has_value());
+}
+
+TEST_F(SpillQueueTest, DiscardTornRecord)
+{
+    std::filesystem::path segment;
+    std::size_t           intact{ 0 };
+    {
+        auto queue = Construct();
+        queue->Append("db", "rp", "m f=1");
+        queue->Append("db", "rp", "m f=2");
+        segment = directory_ / "00000000000000000000.seg";
+        intact  = queue->DiskBytes();
+    }
+
+    // A record whose length exceeds the rest of the file.
+    std::ofstream(segment, std::ios::binary | std::ios::app)
+        .write("\x20\0\0\0\0\0\0\0ab", 10);
+
+    auto queue = Construct();
+    EXPECT_EQ(std::filesystem::file_size(segment), intact);
+    EXPECT_EQ(queue->DiskBytes(), intact);
+    queue->Append("db", "rp", "m f=3");
+    ExpectFront(*queue, "db", "rp", "m f=1");
+    ExpectFront(*queue, "db", "rp", "m f=2");
+    ExpectFront(*queue, "db", "rp", "m f=3");
+    EXPECT_FALSE(queue->Front().has_value());
+}
+
+TEST_F(SpillQueueTest, SkipCorruptedRecords)
+{
+    config_.segmentBytes = 32;
+    auto queue           = Construct();
+    queue->Append("db", "rp", "m f=1");
+    queue->Append("db", "rp", "m f=2");
+
+    // Flips a byte of the body of the first record.
+    {
+        std::fstream file(directory_ / "00000000000000000000.seg",
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('0');
+    }
+    ExpectFront(*queue, "db", "rp", "m f=2");
+    EXPECT_FALSE(queue->Front().has_value());
+}
+
+TEST_F(SpillQueueTest, SkipCorruptedRecordInMiddleOfSegment)
+{
+    auto queue = Construct();
+    queue->Append("db", "rp", "m f=1");
+    queue->Append("db", "rp", "m f=2");
+    auto end = queue->DiskBytes();
+    queue->Append("db", "rp", "m f=3");
+
+    // Flips the last byte of the body of the second record.
+    {
+        std::fstream file(directory_ / "00000000000000000000.seg",
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(end) - 1);
+        file.put('0');
+    }
+    ExpectFront(*queue, "db", "rp", "m f=1");
+    ExpectFront(*queue, "db", "rp", "m f=3");
+    EXPECT_FALSE(queue->Front().has_value());
+
+    // The skipped record is not replayed again after a restart.
+    queue->Append("db", "rp", "m f=4");
+    queue.reset();
+    queue = Construct();
+    ExpectFront(*queue, "db", "rp", "m f=4");
+    EXPECT_FALSE(queue->Front().has_value());
+}
+
+TEST_F(SpillQueueTest, RejectSegmentWithoutFormatVersion)
+{
+    std::filesystem::create_directories(directory_);
+    // A record appended before segments started with a header.
+    std::ofstream(directory_ / "00000000000000000000.seg", std::ios::binary)
+        .write("\x05\0\0\0\0\0\0\0m f=1", 13);
+
+    EXPECT_THROW_AS(Construct(), errc::RuntimeErrors::SpillFailed);
+}
+
+TEST_F(SpillQueueTest, ReplayUntilSenderSucceeds)
+{
+    std::vector<std::string> sent;
+    std::promise<void>       done;
+    std::size_t              failures{ 3 };
+
+    auto queue = Construct(
+        [&](const SpillQueue::Entry& entry, boost::asio::yield_context) {
+            if (failures != 0) {
+                --failures;
+                return false;
+            }
+            sent.push_back(entry.body);
+            if (sent.size() == 3) { done.set_value(); }
+            return true;
+        });
+    queue->Append("db", "rp", "m f=1");
+    queue->Append("db", "rp", "m f=2");
+    queue->Append("db", "rp", "m f=3");
+    queue->StartReplay();
+
+    EXPECT_EQ(done.get_future().wait_for(5s), std::future_status::ready);
+    // The checkpoint is saved by the Pop() after the last send.
+    for (auto waited = 0ms; queue->DiskBytes() != 0 && waited < 5s;
+         waited += 10ms) {
+        std::this_thread::sleep_for(10ms);
+    }
+    queue->StopReplay();
+    EXPECT_EQ(sent, (std::vector<std::string>{ "m f=1", "m f=2", "m f=3" }));
+    EXPECT_EQ(failures, 0);
+}
+
+} // namespace opengemini::test
@@ -0,0 +1,78 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/util/FindFirstOf.hpp"
+
+namespace opengemini::test {
+
+namespace {
+
+std::vector<util::detail::FindFirstOfFunction> AvailableImplementations()
+{
+    std::vector<util::detail::FindFirstOfFunction> functions{
+        util::detail::FindFirstOfScalarEntry,
+    };
+#ifdef OPENGEMINI_FIND_FIRST_OF_SSE2
+    functions.push_back(util::detail::FindFirstOfSse2);
+#endif
+#ifdef OPENGEMINI_FIND_FIRST_OF_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        functions.push_back(util::detail::FindFirstOfAvx2);
+    }
+#endif
+    return functions;
+}
+
+} // namespace
+
+TEST(FindFirstOfTest, WithoutMatchedChar)
+{
+    for (auto function : AvailableImplementations()) {
+        for (std::size_t size = 0; size < 100; ++size) {
+            std::string data(size, 'a');
+            EXPECT_EQ(function(data, ", ="), size);
+        }
+    }
+}
+
+TEST(FindFirstOfTest, MatchedCharAtEveryPosition)
+{
+    for (auto function : AvailableImplementations()) {
+        for (std::size_t size = 1; size < 100; ++size) {
+            for (std::size_t pos = 0; pos < size; ++pos) {
+                for (auto ch : std::string_view{ ", =" }) {
+                    std::string data(size, 'a');
+                    data[pos] = ch;
+                    EXPECT_EQ(function(data, ", ="), pos);
+
+                    data.back() = ch;
+                    EXPECT_EQ(function(data, ", ="), pos);
+                }
+            }
+        }
+    }
+}
+
+TEST(FindFirstOfTest, WithSetLargerThanVectorizedLimit)
+{
+    EXPECT_EQ(util::FindFirstOf("abcdefg", "xyzuvf"), 5);
+    EXPECT_EQ(util::FindFirstOf("abcdefg", "xyzuvw"), 7);
+}
+
+} // namespace opengemini::test
@@ -0,0 +1,50 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "opengemini/impl/util/PercentEncode.hpp"
+
+namespace opengemini::test {
+
+TEST(PercentEncodeTest, KeepUnreservedChars)
+{
+    const std::string unreserved{ "abcxyzABCXYZ0189-._~" };
+    EXPECT_EQ(util::PercentEncode(unreserved), unreserved);
+    EXPECT_EQ(util::PercentEncode(""), "");
+}
+
+TEST(PercentEncodeTest, EncodeReservedChars)
+{
+    EXPECT_EQ(util::PercentEncode("a&b=c"), "a%26b%3Dc");
+    EXPECT_EQ(util::PercentEncode(R"(DROP DATABASE "db")"),
+              "DROP%20DATABASE%20%22db%22");
+    EXPECT_EQ(util::PercentEncode("?#/+%"), "%3F%23%2F%2B%25");
+}
+
+TEST(PercentEncodeTest, EncodeEveryByteOfUtf8)
+{
+    EXPECT_EQ(util::PercentEncode("数"), "%E6%95%B0");
+    EXPECT_EQ(util::PercentEncode(std::string(1, '\0')), "%00");
+}
+
+TEST(PercentEncodeTest, AppendToExistingContent)
+{
+    std::string target{ "/write?db=" };
+    util::PercentEncodeTo("my db", target);
+    EXPECT_EQ(target, "/write?db=my%20db");
+}
+
+} // namespace opengemini::test
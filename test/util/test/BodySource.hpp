@@ -0,0 +1,71 @@
+// Copyright 2024 openGemini Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TEST_UTIL_TEST_BODYSOURCE_HPP
+#define TEST_UTIL_TEST_BODYSOURCE_HPP
+
+#include <string>
+#include <string_view>
+
+#include <boost/beast.hpp>
+
+#include "opengemini/impl/http/StreamingBody.hpp"
+
+namespace opengemini::test {
+
+class StringBodySource : public impl::http::BodySource {
+public:
+    StringBodySource(std::string content, std::size_t pieceSize) :
+        content_(std::move(content)),
+        pieceSize_(pieceSize)
+    { }
+
+    void Rewind() override
+    {
+        ++rewinds_;
+        offset_ = 0;
+    }
+
+    bool Produce(util::ChunkChain& chain) override
+    {
+        auto piece = std::string_view(content_).substr(offset_, pieceSize_);
+        chain.Append(piece);
+        offset_ += piece.size();
+        return offset_ < content_.size();
+    }
+
+    std::size_t Rewinds() const noexcept { return rewinds_; }
+
+private:
+    const std::string content_;
+    const std::size_t pieceSize_;
+    std::size_t       offset_{ 0 };
+    std::size_t       rewinds_{ 0 };
+};
+
+inline std::string ReadBodySource(impl::http::BodySource& source)
+{
+    std::string content;
+    source.Rewind();
+    for (auto more = true; more;) {
+        util::ChunkChain chain;
+        more = source.Produce(chain);
+        content += boost::beast::buffers_to_string(chain.Buffers());
+    }
+    return content;
+}
+
+} // namespace opengemini::test
+
+#endif // !TEST_UTIL_TEST_BODYSOURCE_HPP
@@ -27,17 +27,21 @@ namespace opengemini::test {
 using namespace opengemini::impl;
 
 OPENGEMINI_TEST_MEMBER_HACKER(ClientImpl,
-                              &ClientImpl::ctx_,  // 0
-                              &ClientImpl::http_, // 1
-                              &ClientImpl::lb_)   // 2
+                              &ClientImpl::ctx_,          // 0
+                              &ClientImpl::http_,         // 1
+                              &ClientImpl::lb_,           // 2
+                              &ClientImpl::replicaSpills_) // 3
 
 class ClientImplTestFixture : public testing::Test {
 protected:
     ClientImplTestFixture() :
-        impl_(ClientConfigBuilder()
-                  .AppendAddress({ "127.0.0.1", 1234 })
-                  .AppendAddress({ "127.0.0.1", 4321 })
-                  .Finalize())
+        ClientImplTestFixture(ClientConfigBuilder()
+                                  .AppendAddress({ "127.0.0.1", 1234 })
+                                  .AppendAddress({ "127.0.0.1", 4321 })
+                                  .Finalize())
+    { }
+
+    explicit ClientImplTestFixture(const ClientConfig& config) : impl_(config)
     {
         auto  hackImpl = HackingMember(impl_);
         auto& ctx_     = impl_.*(std::get<0>(hackImpl));
@@ -37,6 +37,13 @@ public:
                  impl::http::Request,
                  boost::asio::yield_context),
                 (override));
+
+    MOCK_METHOD(impl::http::Response,
+                SendStreamRequest,
+                (const Endpoint&,
+                 impl::http::StreamRequest,
+                 boost::asio::yield_context),
+                (override));
 };
 
 } // namespace opengemini::test